@@ -116,7 +116,7 @@ bool ZPhysicalMemoryBacking::commit_inner(size_t offset, size_t length) const {
   return true;
 }
 
-size_t ZPhysicalMemoryBacking::commit(size_t offset, size_t length) const {
+size_t ZPhysicalMemoryBacking::commit(size_t offset, size_t length, bool numa_local) const {
   // Try to commit the whole region
   if (commit_inner(offset, length)) {
     // Success
@@ -38,7 +38,7 @@ public:
 
   void warn_commit_limits(size_t max_capacity) const;
 
-  size_t commit(size_t offset, size_t length) const;
+  size_t commit(size_t offset, size_t length, bool numa_local) const;
   size_t uncommit(size_t offset, size_t length) const;
 
   void map(uintptr_t addr, size_t size, uintptr_t offset) const;
@@ -652,6 +652,20 @@ size_t ZPhysicalMemoryBacking::commit_numa_interleaved(size_t offset, size_t len
   return committed;
 }
 
+size_t ZPhysicalMemoryBacking::commit_numa_local(size_t offset, size_t length) const {
+  // Setup NUMA policy to allocate memory from the node of the current
+  // thread. This is only a preference, the kernel will fall back to
+  // other nodes if the local node is out of memory.
+  os::Linux::numa_set_preferred((int)ZNUMA::id());
+
+  const size_t committed = commit_default(offset, length);
+
+  // Restore NUMA policy
+  os::Linux::numa_set_preferred(-1);
+
+  return committed;
+}
+
 size_t ZPhysicalMemoryBacking::commit_default(size_t offset, size_t length) const {
   // Try to commit the whole region
   if (commit_inner(offset, length)) {
@@ -680,8 +694,13 @@ size_t ZPhysicalMemoryBacking::commit_default(size_t offset, size_t length) cons
   }
 }
 
-size_t ZPhysicalMemoryBacking::commit(size_t offset, size_t length) const {
+size_t ZPhysicalMemoryBacking::commit(size_t offset, size_t length, bool numa_local) const {
   if (ZNUMA::is_enabled() && !ZLargePages::is_explicit()) {
+    if (numa_local) {
+      // Commit the memory on the NUMA node of the requesting thread
+      return commit_numa_local(offset, length);
+    }
+
     // To get granule-level NUMA interleaving when using non-large pages,
     // we must explicitly interleave the memory at commit/fallocate time.
     return commit_numa_interleaved(offset, length);
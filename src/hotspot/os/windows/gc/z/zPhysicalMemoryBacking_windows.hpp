@@ -46,7 +46,7 @@ public:
 
   void warn_commit_limits(size_t max_capacity) const;
 
-  size_t commit(size_t offset, size_t length);
+  size_t commit(size_t offset, size_t length, bool numa_local);
   size_t uncommit(size_t offset, size_t length);
 
   void map(uintptr_t addr, size_t size, size_t offset) const;
@@ -414,7 +414,24 @@ OopStorage::Block::block_for_ptr(const OopStorage* owner, const oop* ptr) {
 
 oop* OopStorage::allocate() {
   MutexLocker ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+  return allocate_locked();
+}
+
+size_t OopStorage::allocate(oop** ptrs, size_t size) {
+  MutexLocker ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+  size_t allocated = 0;
+  for ( ; allocated < size; ++allocated) {
+    oop* result = allocate_locked();
+    if (result == NULL) break; // Block allocation failed.
+    ptrs[allocated] = result;
+  }
+  log_trace(oopstorage, ref)("%s: bulk allocated " SIZE_FORMAT " of " SIZE_FORMAT,
+                             name(), allocated, size);
+  return allocated;
+}
 
+oop* OopStorage::allocate_locked() {
+  assert_lock_strong(_allocation_mutex);
   Block* block = block_for_allocation();
   if (block == NULL) return NULL; // Block allocation failed.
   assert(!block->is_full(), "invariant");
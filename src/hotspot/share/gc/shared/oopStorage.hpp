@@ -104,6 +104,12 @@ public:
   // postcondition: *result == NULL.
   oop* allocate();
 
+  // Allocates multiple entries, storing them in ptrs.  Returns the number
+  // of entries allocated, which is less than size only if memory allocation
+  // failed.  Locks _allocation_mutex once for all entries.
+  // postcondition: *ptrs[i] == NULL, for i < result.
+  size_t allocate(oop** ptrs, size_t size);
+
   // Deallocates ptr.  No locking.
   // precondition: ptr is a valid allocated entry.
   // precondition: *ptr == NULL.
@@ -255,6 +261,7 @@ private:
 
   bool try_add_block();
   Block* block_for_allocation();
+  oop* allocate_locked();
 
   Block* find_block_or_null(const oop* ptr) const;
   void delete_empty_block(const Block& block);
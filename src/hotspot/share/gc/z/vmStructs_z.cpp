@@ -30,8 +30,11 @@ ZGlobalsForVMStructs::ZGlobalsForVMStructs() :
     _ZAddressGoodMask(&ZAddressGoodMask),
     _ZAddressBadMask(&ZAddressBadMask),
     _ZAddressWeakBadMask(&ZAddressWeakBadMask),
+    _ZGranuleSizeShift(&ZGranuleSizeShift),
+    _ZPageSizeSmallShift(&ZPageSizeSmallShift),
     _ZObjectAlignmentSmallShift(&ZObjectAlignmentSmallShift),
-    _ZObjectAlignmentSmall(&ZObjectAlignmentSmall) {
+    _ZObjectAlignmentSmall(&ZObjectAlignmentSmall),
+    _ZObjectAlignmentLargeShift(&ZObjectAlignmentLargeShift) {
 }
 
 ZGlobalsForVMStructs ZGlobalsForVMStructs::_instance;
@@ -49,8 +49,12 @@ public:
   uintptr_t* _ZAddressBadMask;
   uintptr_t* _ZAddressWeakBadMask;
 
+  size_t* _ZGranuleSizeShift;
+  size_t* _ZPageSizeSmallShift;
+
   const int* _ZObjectAlignmentSmallShift;
   const int* _ZObjectAlignmentSmall;
+  int* _ZObjectAlignmentLargeShift;
 };
 
 typedef ZGranuleMap<ZPage*> ZGranuleMapForPageTable;
@@ -63,8 +67,11 @@ typedef ZAttachedArray<ZForwarding, ZForwardingEntry> ZAttachedArrayForForwardin
   nonstatic_field(ZGlobalsForVMStructs,         _ZAddressGoodMask,    uintptr_t*)                    \
   nonstatic_field(ZGlobalsForVMStructs,         _ZAddressBadMask,     uintptr_t*)                    \
   nonstatic_field(ZGlobalsForVMStructs,         _ZAddressWeakBadMask, uintptr_t*)                    \
+  nonstatic_field(ZGlobalsForVMStructs,         _ZGranuleSizeShift,   size_t*)                       \
+  nonstatic_field(ZGlobalsForVMStructs,         _ZPageSizeSmallShift, size_t*)                       \
   nonstatic_field(ZGlobalsForVMStructs,         _ZObjectAlignmentSmallShift, const int*)             \
   nonstatic_field(ZGlobalsForVMStructs,         _ZObjectAlignmentSmall, const int*)                  \
+  nonstatic_field(ZGlobalsForVMStructs,         _ZObjectAlignmentLargeShift, int*)                   \
                                                                                                      \
   nonstatic_field(ZCollectedHeap,               _heap,                ZHeap)                         \
                                                                                                      \
@@ -94,12 +101,9 @@ typedef ZAttachedArray<ZForwarding, ZForwardingEntry> ZAttachedArrayForForwardin
   declare_constant(ZPageTypeSmall)                                                                   \
   declare_constant(ZPageTypeMedium)                                                                  \
   declare_constant(ZPageTypeLarge)                                                                   \
-  declare_constant(ZObjectAlignmentMediumShift)                                                      \
-  declare_constant(ZObjectAlignmentLargeShift)
+  declare_constant(ZObjectAlignmentMediumShift)
 
 #define VM_LONG_CONSTANTS_ZGC(declare_constant)                                                      \
-  declare_constant(ZGranuleSizeShift)                                                                \
-  declare_constant(ZPageSizeSmallShift)                                                              \
   declare_constant(ZPageSizeMediumShift)                                                             \
   declare_constant(ZAddressOffsetShift)                                                              \
   declare_constant(ZAddressOffsetBits)                                                               \
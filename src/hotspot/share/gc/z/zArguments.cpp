@@ -39,6 +39,9 @@ void ZArguments::initialize_alignments() {
 void ZArguments::initialize() {
   GCArguments::initialize();
 
+  // Select granule size, which all page sizes and worker heuristics depend on
+  ZHeuristics::set_granule_size();
+
   // Check mark stack size
   const size_t mark_stack_space_limit = ZAddressSpaceLimit::mark_stack();
   if (ZMarkStackSpaceLimit > mark_stack_space_limit) {
@@ -58,6 +58,9 @@ bool ZBarrierSetNMethod::nmethod_entry_barrier(nmethod* nm) {
   ZNMethod::nmethod_oops_do(nm, &cl);
   disarm(nm);
 
+  // The nmethod was entered this cycle
+  ZNMethod::reset_hotness(nm);
+
   return true;
 }
 
@@ -31,12 +31,13 @@ private:
   static bm_word_t bit_mask_pair(idx_t bit);
 
   bool par_set_bit_pair_finalizable(idx_t bit, bool& inc_live);
-  bool par_set_bit_pair_strong(idx_t bit, bool& inc_live);
+  bool par_set_bit_pair_strong(idx_t bit, bool& inc_live, bool& contention);
 
 public:
   ZBitMap(idx_t size_in_bits);
 
   bool par_set_bit_pair(idx_t bit, bool finalizable, bool& inc_live);
+  bool par_set_bit_pair(idx_t bit, bool finalizable, bool& inc_live, bool& contention);
 };
 
 #endif // SHARE_GC_Z_ZBITMAP_HPP
@@ -42,7 +42,7 @@ inline bool ZBitMap::par_set_bit_pair_finalizable(idx_t bit, bool& inc_live) {
   return inc_live;
 }
 
-inline bool ZBitMap::par_set_bit_pair_strong(idx_t bit, bool& inc_live) {
+inline bool ZBitMap::par_set_bit_pair_strong(idx_t bit, bool& inc_live, bool& contention) {
   verify_index(bit);
   volatile bm_word_t* const addr = word_addr(bit);
   const bm_word_t pair_mask = bit_mask_pair(bit);
@@ -64,16 +64,22 @@ inline bool ZBitMap::par_set_bit_pair_strong(idx_t bit, bool& inc_live) {
     }
 
     // The value changed, retry
+    contention = true;
     old_val = cur_val;
   } while (true);
 }
 
-inline bool ZBitMap::par_set_bit_pair(idx_t bit, bool finalizable, bool& inc_live) {
+inline bool ZBitMap::par_set_bit_pair(idx_t bit, bool finalizable, bool& inc_live, bool& contention) {
   if (finalizable) {
     return par_set_bit_pair_finalizable(bit, inc_live);
   } else {
-    return par_set_bit_pair_strong(bit, inc_live);
+    return par_set_bit_pair_strong(bit, inc_live, contention);
   }
 }
 
+inline bool ZBitMap::par_set_bit_pair(idx_t bit, bool finalizable, bool& inc_live) {
+  bool contention = false;
+  return par_set_bit_pair(bit, finalizable, inc_live, contention);
+}
+
 #endif // SHARE_GC_Z_ZBITMAP_INLINE_HPP
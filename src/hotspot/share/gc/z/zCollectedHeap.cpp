@@ -126,11 +126,13 @@ uint32_t ZCollectedHeap::hash_oop(oop obj) const {
 }
 
 HeapWord* ZCollectedHeap::allocate_new_tlab(size_t min_size, size_t requested_size, size_t* actual_size) {
-  const size_t size_in_bytes = ZUtils::words_to_bytes(align_object_size(requested_size));
-  const uintptr_t addr = _heap.alloc_tlab(size_in_bytes);
+  const size_t min_size_in_bytes = ZUtils::words_to_bytes(align_object_size(min_size));
+  const size_t requested_size_in_bytes = ZUtils::words_to_bytes(align_object_size(requested_size));
+  size_t actual_size_in_bytes = 0;
+  const uintptr_t addr = _heap.alloc_tlab(min_size_in_bytes, requested_size_in_bytes, &actual_size_in_bytes);
 
   if (addr != 0) {
-    *actual_size = requested_size;
+    *actual_size = ZUtils::bytes_to_words(actual_size_in_bytes);
   }
 
   return (HeapWord*)addr;
@@ -257,6 +259,10 @@ void ZCollectedHeap::object_iterate(ObjectClosure* cl) {
   _heap.object_iterate(cl, true /* visit_weaks */);
 }
 
+ParallelObjectIterator* ZCollectedHeap::parallel_object_iterator(uint nworkers) {
+  return _heap.parallel_object_iterator(nworkers, true /* visit_weaks */);
+}
+
 void ZCollectedHeap::keep_alive(oop obj) {
   _heap.keep_alive(obj);
 }
@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "gc/z/zCollectedHeap.hpp"
 #include "gc/z/zDirector.hpp"
+#include "gc/z/zEventLog.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zUtils.hpp"
@@ -167,8 +168,12 @@ bool ZDirector::rule_proactive() const {
   const double acceptable_gc_interval = max_duration_of_gc * ((assumed_throughput_drop_during_gc / acceptable_throughput_drop) - 1.0);
   const double time_until_gc = acceptable_gc_interval - time_since_last_gc;
 
-  log_debug(gc, director)("Rule: Proactive, AcceptableGCInterval: %.3fs, TimeSinceLastGC: %.3fs, TimeUntilGC: %.3fs",
-                          acceptable_gc_interval, time_since_last_gc, time_until_gc);
+  // The measured GC CPU overhead is reported alongside the assumed
+  // throughput drop, to show how close the assumption is.
+  const AbsSeq& gc_cpu_overhead = ZStatCPUTime::overhead();
+
+  log_debug(gc, director)("Rule: Proactive, AcceptableGCInterval: %.3fs, TimeSinceLastGC: %.3fs, TimeUntilGC: %.3fs, GCCPUOverhead: %.1f%%",
+                          acceptable_gc_interval, time_since_last_gc, time_until_gc, gc_cpu_overhead.davg());
 
   return time_until_gc <= 0;
 }
@@ -226,14 +231,42 @@ GCCause::Cause ZDirector::make_gc_decision() const {
   return GCCause::_no_gc;
 }
 
+void ZDirector::log_gc_decision(GCCause::Cause cause) const {
+  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
+  const size_t used = ZHeap::heap()->used();
+  const size_t free = soft_max_capacity - MIN2(soft_max_capacity, used);
+  const AbsSeq& duration_of_gc = ZStatCycle::normalized_duration();
+
+  ZEventLog::log("Director: %s, Used: " SIZE_FORMAT "M, Free: " SIZE_FORMAT "M, "
+                 "AllocRate: %.3fMB/s (+/- %.1f%%), DurationOfGC: %.3fs (+/- %.3fs), TimeSinceLastGC: %.3fs",
+                 GCCause::to_string(cause), used / M, free / M,
+                 ZStatAllocRate::avg() / M,
+                 percent_of(ZStatAllocRate::avg_sd(), ZStatAllocRate::avg()),
+                 duration_of_gc.davg(), duration_of_gc.dsd(),
+                 ZStatCycle::time_since_last());
+}
+
 void ZDirector::run_service() {
+  GCCause::Cause last_cause = GCCause::_no_gc;
+  uint32_t last_seqnum = 0;
+
   // Main loop
   while (_metronome.wait_for_tick()) {
     sample_allocation_rate();
     const GCCause::Cause cause = make_gc_decision();
     if (cause != GCCause::_no_gc) {
+      // Record the decision once per cause and GC cycle, since
+      // a rule typically keeps triggering for several ticks
+      const uint32_t seqnum = ZGlobalSeqNum;
+      if (cause != last_cause || seqnum != last_seqnum) {
+        log_gc_decision(cause);
+        last_seqnum = seqnum;
+      }
+
       ZCollectedHeap::heap()->collect(cause);
     }
+
+    last_cause = cause;
   }
 }
 
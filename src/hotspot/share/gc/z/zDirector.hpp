@@ -42,6 +42,7 @@ private:
   bool rule_proactive() const;
   bool rule_high_usage() const;
   GCCause::Cause make_gc_decision() const;
+  void log_gc_decision(GCCause::Cause cause) const;
 
 protected:
   virtual void run_service();
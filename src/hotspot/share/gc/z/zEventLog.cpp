@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/z/zEventLog.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/thread.hpp"
+
+StringEventLog*   ZEventLog::_log = NULL;
+volatile uint32_t ZEventLog::_printed_seqnum = 0;
+
+void ZEventLog::initialize() {
+  if (LogEvents && ZEventLogEntries > 0) {
+    _log = new StringEventLog("ZGC Events", "zgc", ZEventLogEntries);
+  }
+}
+
+void ZEventLog::log(const char* format, ...) {
+  if (_log == NULL) {
+    // Disabled
+    return;
+  }
+
+  va_list ap;
+  va_start(ap, format);
+  _log->logv(Thread::current_or_null(), format, ap);
+  va_end(ap);
+}
+
+void ZEventLog::print_at_out_of_memory() {
+  if (_log == NULL) {
+    // Disabled
+    return;
+  }
+
+  // Only print once per GC cycle, since many threads
+  // typically run out of memory at the same time.
+  const uint32_t seqnum = Atomic::load(&ZGlobalSeqNum);
+  const uint32_t prev_seqnum = Atomic::load(&_printed_seqnum);
+  if (prev_seqnum == seqnum || Atomic::cmpxchg(&_printed_seqnum, prev_seqnum, seqnum) != prev_seqnum) {
+    // Already printed
+    return;
+  }
+
+  LogTarget(Warning, gc) lt;
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    _log->print_log_on(&ls);
+  }
+}
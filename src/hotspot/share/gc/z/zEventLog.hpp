@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#ifndef SHARE_GC_Z_ZEVENTLOG_HPP
+#define SHARE_GC_Z_ZEVENTLOG_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/events.hpp"
+
+//
+// An always-on ring buffer of the most recent GC cycles, phases, director
+// decisions, allocation stalls and relocation set summaries. Since it is
+// an EventLog it is automatically included in hs_err files and can be
+// printed with "jcmd <pid> VM.events log=zgc".
+//
+class ZEventLog : public AllStatic {
+private:
+  static StringEventLog*  _log;
+  static volatile uint32_t _printed_seqnum;
+
+public:
+  static void initialize();
+
+  static void log(const char* format, ...) ATTRIBUTE_PRINTF(1, 2);
+
+  static void print_at_out_of_memory();
+};
+
+#endif // SHARE_GC_Z_ZEVENTLOG_HPP
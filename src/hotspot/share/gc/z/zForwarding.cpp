@@ -45,6 +45,7 @@ void ZForwarding::destroy(ZForwarding* forwarding) {
 ZForwarding::ZForwarding(ZPage* page, size_t nentries) :
     _virtual(page->virtual_memory()),
     _object_alignment_shift(page->object_alignment_shift()),
+    _age(page->age()),
     _entries(nentries),
     _page(page),
     _refcount(1),
@@ -41,6 +41,7 @@ private:
 
   const ZVirtualMemory _virtual;
   const size_t         _object_alignment_shift;
+  const uint8_t        _age;
   const AttachedArray  _entries;
   ZPage*               _page;
   volatile uint32_t    _refcount;
@@ -63,6 +64,7 @@ public:
   uintptr_t start() const;
   size_t size() const;
   size_t object_alignment_shift() const;
+  uint8_t age() const;
   ZPage* page() const;
 
   bool is_pinned() const;
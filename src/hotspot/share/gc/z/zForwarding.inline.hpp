@@ -45,6 +45,10 @@ inline size_t ZForwarding::object_alignment_shift() const {
   return _object_alignment_shift;
 }
 
+inline uint8_t ZForwarding::age() const {
+  return _age;
+}
+
 inline ZPage* ZForwarding::page() const {
   return _page;
 }
@@ -27,16 +27,25 @@
 uint32_t   ZGlobalPhase                = ZPhaseRelocate;
 uint32_t   ZGlobalSeqNum               = 1;
 
+size_t     ZGranuleSizeShift           = ZPlatformGranuleSizeShift;
+size_t     ZGranuleSize                = (size_t)1 << ZPlatformGranuleSizeShift;
+
+size_t     ZPageSizeSmallShift         = ZPlatformGranuleSizeShift;
 size_t     ZPageSizeMediumShift;
+
+size_t     ZPageSizeSmall              = (size_t)1 << ZPlatformGranuleSizeShift;
 size_t     ZPageSizeMedium;
 
+size_t     ZObjectSizeLimitSmall       = ((size_t)1 << ZPlatformGranuleSizeShift) / 8;
 size_t     ZObjectSizeLimitMedium;
 
 const int& ZObjectAlignmentSmallShift  = LogMinObjAlignmentInBytes;
 int        ZObjectAlignmentMediumShift;
+int        ZObjectAlignmentLargeShift  = ZPlatformGranuleSizeShift;
 
 const int& ZObjectAlignmentSmall       = MinObjAlignmentInBytes;
 int        ZObjectAlignmentMedium;
+int        ZObjectAlignmentLarge       = 1 << ZPlatformGranuleSizeShift;
 
 uintptr_t  ZAddressGoodMask;
 uintptr_t  ZAddressBadMask;
@@ -62,6 +71,8 @@ uintptr_t  ZAddressMetadataMarked1;
 uintptr_t  ZAddressMetadataRemapped;
 uintptr_t  ZAddressMetadataFinalizable;
 
+size_t     ZMarkStripeShift            = ZPlatformGranuleSizeShift;
+
 const char* ZGlobalPhaseToString() {
   switch (ZGlobalPhase) {
   case ZPhaseMark:
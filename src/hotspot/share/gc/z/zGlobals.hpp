@@ -42,8 +42,9 @@ const char*       ZGlobalPhaseToString();
 extern uint32_t   ZGlobalSeqNum;
 
 // Granule shift/size
-const size_t      ZGranuleSizeShift             = ZPlatformGranuleSizeShift;
-const size_t      ZGranuleSize                  = (size_t)1 << ZGranuleSizeShift;
+extern size_t     ZGranuleSizeShift;
+extern size_t     ZGranuleSize;
+const size_t      ZGranuleSizeMin               = (size_t)1 << 19; // 512K
 
 // Number of heap views
 const size_t      ZHeapViews                    = ZPlatformHeapViews;
@@ -56,27 +57,30 @@ const uint8_t     ZPageTypeSmall                = 0;
 const uint8_t     ZPageTypeMedium               = 1;
 const uint8_t     ZPageTypeLarge                = 2;
 
+// Page age, in number of GC cycles survived
+const uint8_t     ZPageAgeMax                   = 15;
+
 // Page size shifts
-const size_t      ZPageSizeSmallShift           = ZGranuleSizeShift;
+extern size_t     ZPageSizeSmallShift;
 extern size_t     ZPageSizeMediumShift;
 
 // Page sizes
-const size_t      ZPageSizeSmall                = (size_t)1 << ZPageSizeSmallShift;
+extern size_t     ZPageSizeSmall;
 extern size_t     ZPageSizeMedium;
 
 // Object size limits
-const size_t      ZObjectSizeLimitSmall         = ZPageSizeSmall / 8; // 12.5% max waste
+extern size_t     ZObjectSizeLimitSmall; // 12.5% max waste
 extern size_t     ZObjectSizeLimitMedium;
 
 // Object alignment shifts
 extern const int& ZObjectAlignmentSmallShift;
 extern int        ZObjectAlignmentMediumShift;
-const int         ZObjectAlignmentLargeShift    = ZGranuleSizeShift;
+extern int        ZObjectAlignmentLargeShift;
 
 // Object alignments
 extern const int& ZObjectAlignmentSmall;
 extern int        ZObjectAlignmentMedium;
-const int         ZObjectAlignmentLarge         = 1 << ZObjectAlignmentLargeShift;
+extern int        ZObjectAlignmentLarge;
 
 //
 // Good/Bad mask states
@@ -136,7 +140,7 @@ const size_t      ZMarkStackMagazineSize        = (size_t)1 << 15; // 32K
 const size_t      ZMarkStackMagazineSlots       = (ZMarkStackMagazineSize / ZMarkStackSize) - 1;
 
 // Mark stripe size
-const size_t      ZMarkStripeShift              = ZGranuleSizeShift;
+extern size_t     ZMarkStripeShift;
 
 // Max number of mark stripes
 const size_t      ZMarkStripesMax               = 16; // Must be a power of two
@@ -152,7 +156,14 @@ const size_t      ZMarkPartialArrayMinSize      = (size_t)1 << ZMarkPartialArray
 const size_t      ZMarkProactiveFlushMax        = 10;
 const size_t      ZMarkTerminateFlushMax        = 3;
 
+// Max number of threads to handshake individually when flushing
+const size_t      ZMarkTargetedFlushMax         = 32;
+
 // Try complete mark timeout
 const uint64_t    ZMarkCompleteTimeout          = 1000; // us
 
+// Relocation buffer size, and max size of objects relocated through it
+const size_t      ZRelocationBufferSize         = (size_t)1 << 15; // 32K
+const size_t      ZRelocationBufferObjectMax    = ZRelocationBufferSize / 8;
+
 #endif // SHARE_GC_Z_ZGLOBALS_HPP
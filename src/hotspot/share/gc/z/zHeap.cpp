@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "gc/shared/locationPrinter.hpp"
 #include "gc/z/zAddress.inline.hpp"
+#include "gc/z/zEventLog.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zHeapIterator.hpp"
@@ -42,6 +43,7 @@
 #include "logging/log.hpp"
 #include "memory/iterator.hpp"
 #include "memory/resourceArea.hpp"
+#include "prims/jvmtiTagMap.hpp"
 #include "runtime/handshake.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.hpp"
@@ -169,6 +171,10 @@ bool ZHeap::is_in(uintptr_t addr) const {
   return false;
 }
 
+ZWorkers* ZHeap::workers() {
+  return &_workers;
+}
+
 uint ZHeap::nconcurrent_worker_threads() const {
   return _workers.nconcurrent();
 }
@@ -191,6 +197,8 @@ void ZHeap::out_of_memory() {
 
   ZStatInc(ZCounterOutOfMemory);
   log_info(gc)("Out Of Memory (%s)", Thread::current()->name());
+  ZEventLog::log("Out Of Memory (%s)", Thread::current()->name());
+  ZEventLog::print_at_out_of_memory();
 }
 
 ZPage* ZHeap::alloc_page(uint8_t type, size_t size, ZAllocationFlags flags) {
@@ -289,8 +297,8 @@ bool ZHeap::mark_end() {
   // Block resurrection of weak/phantom references
   ZResurrection::block();
 
-  // Process weak roots
-  _weak_roots_processor.process_weak_roots();
+  // Notify JVMTI that some tagmap entry objects may have died
+  JvmtiTagMap::set_needs_cleaning();
 
   // Prepare to unload stale metadata and nmethods
   _unload.prepare();
@@ -341,6 +349,9 @@ void ZHeap::process_non_strong_references() {
   // Purge stale metadata and nmethods that were unlinked
   _unload.purge();
 
+  // Resize metaspace after purging stale metadata
+  _unload.resize();
+
   // Enqueue Soft/Weak/Final/PhantomReferences. Note that this
   // must be done after unblocking resurrection. Otherwise the
   // Finalizer thread could call Reference.get() on the Finalizers
@@ -406,7 +417,7 @@ void ZHeap::reset_relocation_set() {
 void ZHeap::relocate_start() {
   assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
 
-  // Finish unloading stale metadata and nmethods
+  // Finish unloading stale metadata
   _unload.finish();
 
   // Flip address view
@@ -419,8 +430,8 @@ void ZHeap::relocate_start() {
   ZStatSample(ZSamplerHeapUsedBeforeRelocation, used());
   ZStatHeap::set_at_relocate_start(capacity(), allocated(), used());
 
-  // Remap/Relocate roots
-  _relocate.start();
+  // Notify JVMTI that tagmap entry objects may move
+  JvmtiTagMap::set_needs_rehashing();
 }
 
 void ZHeap::relocate() {
@@ -437,8 +448,13 @@ void ZHeap::relocate() {
 void ZHeap::object_iterate(ObjectClosure* cl, bool visit_weaks) {
   assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
 
-  ZHeapIterator iter;
-  iter.objects_do(cl, visit_weaks);
+  ZHeapIterator iter(1 /* nworkers */, visit_weaks);
+  iter.object_iterate(cl, 0 /* worker_id */);
+}
+
+ParallelObjectIterator* ZHeap::parallel_object_iterator(uint nworkers, bool visit_weaks) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+  return new ZHeapIterator(nworkers, visit_weaks);
 }
 
 void ZHeap::pages_do(ZPageClosure* cl) {
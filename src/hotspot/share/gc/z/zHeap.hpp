@@ -39,6 +39,7 @@
 #include "gc/z/zUnload.hpp"
 #include "gc/z/zWorkers.hpp"
 
+class ParallelObjectIterator;
 class ThreadClosure;
 
 class ZHeap {
@@ -94,6 +95,7 @@ public:
   uint32_t hash_oop(uintptr_t addr) const;
 
   // Threads
+  ZWorkers* workers();
   uint nconcurrent_worker_threads() const;
   uint nconcurrent_no_boost_worker_threads() const;
   void set_boost_worker_threads(bool boost);
@@ -107,12 +109,13 @@ public:
   void process_non_strong_references();
 
   // Page allocation
+  ZPage* page(uintptr_t addr) const;
   ZPage* alloc_page(uint8_t type, size_t size, ZAllocationFlags flags);
   void undo_alloc_page(ZPage* page);
   void free_page(ZPage* page, bool reclaimed);
 
   // Object allocation
-  uintptr_t alloc_tlab(size_t size);
+  uintptr_t alloc_tlab(size_t min_size, size_t requested_size, size_t* actual_size);
   uintptr_t alloc_object(size_t size);
   uintptr_t alloc_object_for_relocation(size_t size);
   void undo_alloc_object_for_relocation(uintptr_t addr, size_t size);
@@ -141,6 +144,7 @@ public:
 
   // Iteration
   void object_iterate(ObjectClosure* cl, bool visit_weaks);
+  ParallelObjectIterator* parallel_object_iterator(uint nworkers, bool visit_weaks);
   void pages_do(ZPageClosure* cl);
 
   // Serviceability
@@ -49,6 +49,10 @@ inline uint32_t ZHeap::hash_oop(uintptr_t addr) const {
   return ZHash::address_to_uint32(offset);
 }
 
+inline ZPage* ZHeap::page(uintptr_t addr) const {
+  return _page_table.get(addr);
+}
+
 inline bool ZHeap::is_object_live(uintptr_t addr) const {
   ZPage* page = _page_table.get(addr);
   return page->is_object_live(addr);
@@ -65,9 +69,9 @@ inline void ZHeap::mark_object(uintptr_t addr) {
   _mark.mark_object<follow, finalizable, publish>(addr);
 }
 
-inline uintptr_t ZHeap::alloc_tlab(size_t size) {
-  guarantee(size <= max_tlab_size(), "TLAB too large");
-  return _object_allocator.alloc_object(size);
+inline uintptr_t ZHeap::alloc_tlab(size_t min_size, size_t requested_size, size_t* actual_size) {
+  guarantee(requested_size <= max_tlab_size(), "TLAB too large");
+  return _object_allocator.alloc_tlab(min_size, requested_size, actual_size);
 }
 
 inline uintptr_t ZHeap::alloc_object(size_t size) {
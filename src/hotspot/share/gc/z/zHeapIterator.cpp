@@ -24,18 +24,20 @@
 #include "precompiled.hpp"
 #include "classfile/classLoaderData.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zGranuleMap.inline.hpp"
 #include "gc/z/zHeapIterator.hpp"
+#include "gc/z/zLock.inline.hpp"
 #include "gc/z/zOop.inline.hpp"
 #include "gc/z/zRootsIterator.hpp"
 #include "gc/z/zStat.hpp"
 #include "memory/iterator.inline.hpp"
+#include "oops/objArrayOop.inline.hpp"
 #include "runtime/stackWatermarkSet.hpp"
 #include "utilities/bitMap.inline.hpp"
-#include "utilities/stack.inline.hpp"
 
 class ZHeapIteratorBitMap : public CHeapObj<mtGC> {
 private:
@@ -46,19 +48,15 @@ public:
       _map(size_in_bits) {}
 
   bool try_set_bit(size_t index) {
-    if (_map.at(index)) {
-      return false;
-    }
-
-    _map.set_bit(index);
-    return true;
+    return _map.par_set_bit(index);
   }
 };
 
 template <bool Concurrent, bool Weak>
 class ZHeapIteratorRootOopClosure : public ZRootsIteratorClosure {
 private:
-  ZHeapIterator* const _iter;
+  ZHeapIterator* const      _iter;
+  ZHeapIteratorQueue* const _queue;
 
   oop load_oop(oop* p) {
     if (Weak) {
@@ -73,12 +71,13 @@ private:
   }
 
 public:
-  ZHeapIteratorRootOopClosure(ZHeapIterator* iter) :
-      _iter(iter) {}
+  ZHeapIteratorRootOopClosure(ZHeapIterator* iter, ZHeapIteratorQueue* queue) :
+      _iter(iter),
+      _queue(queue) {}
 
   virtual void do_oop(oop* p) {
     const oop obj = load_oop(p);
-    _iter->push(obj);
+    _iter->push(_queue, obj);
   }
 
   virtual void do_oop(narrowOop* p) {
@@ -97,8 +96,9 @@ public:
 template <bool VisitReferents>
 class ZHeapIteratorOopClosure : public ClaimMetadataVisitingOopIterateClosure {
 private:
-  ZHeapIterator* const _iter;
-  const oop            _base;
+  ZHeapIterator* const      _iter;
+  ZHeapIteratorQueue* const _queue;
+  const oop                 _base;
 
   oop load_oop(oop* p) {
     if (VisitReferents) {
@@ -109,9 +109,10 @@ private:
   }
 
 public:
-  ZHeapIteratorOopClosure(ZHeapIterator* iter, oop base) :
+  ZHeapIteratorOopClosure(ZHeapIterator* iter, ZHeapIteratorQueue* queue, oop base) :
       ClaimMetadataVisitingOopIterateClosure(ClassLoaderData::_claim_other),
       _iter(iter),
+      _queue(queue),
       _base(base) {}
 
   virtual ReferenceIterationMode reference_iteration_mode() {
@@ -120,7 +121,7 @@ public:
 
   virtual void do_oop(oop* p) {
     const oop obj = load_oop(p);
-    _iter->push(obj);
+    _iter->push(_queue, obj);
   }
 
   virtual void do_oop(narrowOop* p) {
@@ -134,15 +135,43 @@ public:
 #endif
 };
 
-ZHeapIterator::ZHeapIterator() :
-    _visit_stack(),
-    _visit_map(ZAddressOffsetMax) {}
+ZHeapIterator::ZHeapIterator(uint nworkers, bool visit_weaks) :
+    _visit_weaks(visit_weaks),
+    _timer_disable(),
+    _visit_map(ZAddressOffsetMax),
+    _visit_map_lock(),
+    _queues(nworkers),
+    _array_queues(nworkers),
+    _roots(),
+    _weak_roots(),
+    _terminator(nworkers, &_queues) {
+
+  // Create queues
+  for (uint i = 0; i < _queues.size(); i++) {
+    ZHeapIteratorQueue* const queue = new ZHeapIteratorQueue();
+    queue->initialize();
+    _queues.register_queue(i, queue);
+
+    ZHeapIteratorArrayQueue* const array_queue = new ZHeapIteratorArrayQueue();
+    array_queue->initialize();
+    _array_queues.register_queue(i, array_queue);
+  }
+}
 
 ZHeapIterator::~ZHeapIterator() {
+  // Destroy bitmaps
   ZVisitMapIterator iter(&_visit_map);
   for (ZHeapIteratorBitMap* map; iter.next(&map);) {
     delete map;
   }
+
+  // Destroy queues
+  for (uint i = 0; i < _queues.size(); i++) {
+    delete _queues.queue(i);
+    delete _array_queues.queue(i);
+  }
+
+  // Clear claimed CLD bits
   ClassLoaderDataGraph::clear_claimed_marks(ClassLoaderData::_claim_other);
 }
 
@@ -159,16 +188,20 @@ static size_t object_index(oop obj) {
 
 ZHeapIteratorBitMap* ZHeapIterator::object_map(oop obj) {
   const uintptr_t offset = ZAddress::offset(ZOop::to_address(obj));
-  ZHeapIteratorBitMap* map = _visit_map.get(offset);
+  ZHeapIteratorBitMap* map = _visit_map.get_acquire(offset);
   if (map == NULL) {
-    map = new ZHeapIteratorBitMap(object_index_max());
-    _visit_map.put(offset, map);
+    ZLocker<ZLock> locker(&_visit_map_lock);
+    map = _visit_map.get(offset);
+    if (map == NULL) {
+      map = new ZHeapIteratorBitMap(object_index_max());
+      _visit_map.release_put(offset, map);
+    }
   }
 
   return map;
 }
 
-void ZHeapIterator::push(oop obj) {
+void ZHeapIterator::push(ZHeapIteratorQueue* queue, oop obj) {
   if (obj == NULL) {
     // Ignore
     return;
@@ -182,50 +215,128 @@ void ZHeapIterator::push(oop obj) {
   }
 
   // Push
-  _visit_stack.push(obj);
+  queue->push(obj);
+}
+
+template <bool VisitReferents>
+void ZHeapIterator::push_fields(ZHeapIteratorQueue* queue, oop obj) {
+  ZHeapIteratorOopClosure<VisitReferents> cl(this, queue, obj);
+  obj->oop_iterate(&cl);
+}
+
+void ZHeapIterator::push_array(ZHeapIteratorQueue* queue, ZHeapIteratorArrayQueue* array_queue, oop obj) {
+  // Visit klass
+  ZHeapIteratorOopClosure<false /* VisitReferents */> cl(this, queue, obj);
+  cl.do_klass(obj->klass());
+
+  // Push first array chunk
+  array_queue->push(ObjArrayTask(obj, 0 /* index */));
 }
 
-template <typename RootsIterator, bool Concurrent, bool Weak>
-void ZHeapIterator::push_roots() {
-  ZHeapIteratorRootOopClosure<Concurrent, Weak> cl(this);
-  RootsIterator roots;
-  roots.oops_do(&cl);
+void ZHeapIterator::push_array_chunk(ZHeapIteratorQueue* queue, ZHeapIteratorArrayQueue* array_queue, const ObjArrayTask& array) {
+  const objArrayOop obj = objArrayOop(array.obj());
+  const int length = obj->length();
+  const int start = array.index();
+  const int stride = MIN2<int>(length - start, ObjArrayMarkingStride);
+  const int end = start + stride;
+
+  // Push remaining array chunk first, so that other
+  // workers can steal it while we push this chunk
+  if (end < length) {
+    array_queue->push(ObjArrayTask(obj, end));
+  }
+
+  // Push array chunk elements to visit
+  ZHeapIteratorOopClosure<false /* VisitReferents */> cl(this, queue, obj);
+  obj->oop_iterate_range(&cl, start, end);
 }
 
 template <bool VisitReferents>
-void ZHeapIterator::push_fields(oop obj) {
-  ZHeapIteratorOopClosure<VisitReferents> cl(this, obj);
-  obj->oop_iterate(&cl);
+void ZHeapIterator::visit_and_push_fields(ZHeapIteratorQueue* queue, ZHeapIteratorArrayQueue* array_queue, ObjectClosure* cl, oop obj) {
+  // Visit object
+  cl->do_object(obj);
+
+  // Push fields to visit. Object arrays are pushed in chunks,
+  // so that large arrays can be shared between workers.
+  if (obj->is_objArray()) {
+    push_array(queue, array_queue, obj);
+  } else {
+    push_fields<VisitReferents>(queue, obj);
+  }
 }
 
 template <bool VisitWeaks>
-void ZHeapIterator::objects_do(ObjectClosure* cl) {
-  ZStatTimerDisable disable;
+void ZHeapIterator::push_roots(ZHeapIteratorQueue* queue) {
+  // The roots iterators are shared by all workers and claim
+  // their parts, so each root is only pushed once.
+  ZHeapIteratorRootOopClosure<true /* Concurrent */, false /* Weak */> cl(this, queue);
+  _roots.oops_do(&cl);
 
-  // Push roots to visit
-  push_roots<ZRootsIterator,                     false /* Concurrent */, false /* Weak */>();
-  push_roots<ZConcurrentRootsIteratorClaimOther, true  /* Concurrent */, false /* Weak */>();
   if (VisitWeaks) {
-    push_roots<ZWeakRootsIterator,           false /* Concurrent */, true  /* Weak */>();
-    push_roots<ZConcurrentWeakRootsIterator, true  /* Concurrent */, true  /* Weak */>();
+    ZHeapIteratorRootOopClosure<true /* Concurrent */, true /* Weak */> weak_cl(this, queue);
+    _weak_roots.oops_do(&weak_cl);
   }
+}
+
+template <bool VisitWeaks>
+void ZHeapIterator::drain(ZHeapIteratorQueue* queue, ZHeapIteratorArrayQueue* array_queue, ObjectClosure* cl) {
+  oop obj;
+  ObjArrayTask array;
 
-  // Drain stack
-  while (!_visit_stack.is_empty()) {
-    const oop obj = _visit_stack.pop();
+  do {
+    while (queue->pop_overflow(obj)) {
+      visit_and_push_fields<VisitWeaks>(queue, array_queue, cl, obj);
+    }
+
+    while (queue->pop_local(obj)) {
+      visit_and_push_fields<VisitWeaks>(queue, array_queue, cl, obj);
+    }
 
-    // Visit object
-    cl->do_object(obj);
+    // Only follow one array chunk at a time, to keep
+    // the number of objects pushed on the queue bounded
+    if (array_queue->pop_overflow(array) || array_queue->pop_local(array)) {
+      push_array_chunk(queue, array_queue, array);
+    }
+  } while (!queue->is_empty() || !array_queue->is_empty());
+}
 
-    // Push fields to visit
-    push_fields<VisitWeaks>(obj);
+template <bool VisitWeaks>
+void ZHeapIterator::steal(ZHeapIteratorQueue* queue, ZHeapIteratorArrayQueue* array_queue, ObjectClosure* cl, uint worker_id) {
+  oop obj;
+  ObjArrayTask array;
+
+  for (;;) {
+    if (_array_queues.steal(worker_id, array)) {
+      push_array_chunk(queue, array_queue, array);
+    } else if (_queues.steal(worker_id, obj)) {
+      visit_and_push_fields<VisitWeaks>(queue, array_queue, cl, obj);
+    } else {
+      // Nothing to steal
+      return;
+    }
+
+    drain<VisitWeaks>(queue, array_queue, cl);
   }
 }
 
-void ZHeapIterator::objects_do(ObjectClosure* cl, bool visit_weaks) {
-  if (visit_weaks) {
-    objects_do<true /* VisitWeaks */>(cl);
+template <bool VisitWeaks>
+void ZHeapIterator::object_iterate(ObjectClosure* cl, uint worker_id) {
+  ZStatTimerDisable disable;
+  ZHeapIteratorQueue* const queue = _queues.queue(worker_id);
+  ZHeapIteratorArrayQueue* const array_queue = _array_queues.queue(worker_id);
+
+  push_roots<VisitWeaks>(queue);
+
+  do {
+    drain<VisitWeaks>(queue, array_queue, cl);
+    steal<VisitWeaks>(queue, array_queue, cl, worker_id);
+  } while (!_terminator.offer_termination());
+}
+
+void ZHeapIterator::object_iterate(ObjectClosure* cl, uint worker_id) {
+  if (_visit_weaks) {
+    object_iterate<true /* VisitWeaks */>(cl, worker_id);
   } else {
-    objects_do<false /* VisitWeaks */>(cl);
+    object_iterate<false /* VisitWeaks */>(cl, worker_id);
   }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2020, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,37 +24,57 @@
 #ifndef SHARE_GC_Z_ZHEAPITERATOR_HPP
 #define SHARE_GC_Z_ZHEAPITERATOR_HPP
 
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/taskTerminator.hpp"
+#include "gc/shared/taskqueue.hpp"
 #include "gc/z/zGranuleMap.hpp"
-#include "memory/allocation.hpp"
-#include "utilities/stack.hpp"
+#include "gc/z/zLock.hpp"
+#include "gc/z/zRootsIterator.hpp"
+#include "gc/z/zStat.hpp"
 
 class ObjectClosure;
 class ZHeapIteratorBitMap;
 
-class ZHeapIterator : public StackObj {
+typedef OverflowTaskQueue<oop, mtGC>                       ZHeapIteratorQueue;
+typedef GenericTaskQueueSet<ZHeapIteratorQueue, mtGC>      ZHeapIteratorQueues;
+typedef OverflowTaskQueue<ObjArrayTask, mtGC>              ZHeapIteratorArrayQueue;
+typedef GenericTaskQueueSet<ZHeapIteratorArrayQueue, mtGC> ZHeapIteratorArrayQueues;
+
+class ZHeapIterator : public ParallelObjectIterator {
   template<bool Concurrent, bool Weak> friend class ZHeapIteratorRootOopClosure;
   template<bool VisitReferents> friend class ZHeapIteratorOopClosure;
 
 private:
   typedef ZGranuleMap<ZHeapIteratorBitMap*>         ZVisitMap;
   typedef ZGranuleMapIterator<ZHeapIteratorBitMap*> ZVisitMapIterator;
-  typedef Stack<oop, mtGC>                          ZVisitStack;
 
-  ZVisitStack _visit_stack;
-  ZVisitMap   _visit_map;
+  const bool                         _visit_weaks;
+  ZStatTimerDisable                  _timer_disable;
+  ZVisitMap                          _visit_map;
+  ZLock                              _visit_map_lock;
+  ZHeapIteratorQueues                _queues;
+  ZHeapIteratorArrayQueues           _array_queues;
+  ZConcurrentRootsIteratorClaimOther _roots;
+  ZConcurrentWeakRootsIterator       _weak_roots;
+  TaskTerminator                     _terminator;
 
   ZHeapIteratorBitMap* object_map(oop obj);
-  void push(oop obj);
+  void push(ZHeapIteratorQueue* queue, oop obj);
 
-  template <typename RootsIterator, bool Concurrent, bool Weak> void push_roots();
-  template <bool VisitReferents> void push_fields(oop obj);
-  template <bool VisitReferents> void objects_do(ObjectClosure* cl);
+  template <bool VisitReferents> void push_fields(ZHeapIteratorQueue* queue, oop obj);
+  void push_array(ZHeapIteratorQueue* queue, ZHeapIteratorArrayQueue* array_queue, oop obj);
+  void push_array_chunk(ZHeapIteratorQueue* queue, ZHeapIteratorArrayQueue* array_queue, const ObjArrayTask& array);
+  template <bool VisitReferents> void visit_and_push_fields(ZHeapIteratorQueue* queue, ZHeapIteratorArrayQueue* array_queue, ObjectClosure* cl, oop obj);
+  template <bool VisitWeaks> void push_roots(ZHeapIteratorQueue* queue);
+  template <bool VisitWeaks> void drain(ZHeapIteratorQueue* queue, ZHeapIteratorArrayQueue* array_queue, ObjectClosure* cl);
+  template <bool VisitWeaks> void steal(ZHeapIteratorQueue* queue, ZHeapIteratorArrayQueue* array_queue, ObjectClosure* cl, uint worker_id);
+  template <bool VisitWeaks> void object_iterate(ObjectClosure* cl, uint worker_id);
 
 public:
-  ZHeapIterator();
-  ~ZHeapIterator();
+  ZHeapIterator(uint nworkers, bool visit_weaks);
+  virtual ~ZHeapIterator();
 
-  void objects_do(ObjectClosure* cl, bool visit_weaks);
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id);
 };
 
 #endif // SHARE_GC_Z_ZHEAPITERATOR_HPP
@@ -27,10 +27,37 @@
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zHeuristics.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/java.hpp"
 #include "runtime/os.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
 
+void ZHeuristics::set_granule_size() {
+  // The granule size defaults to the platform granule size, but can be
+  // lowered to make small pages, and therefore the per-CPU shared pages
+  // and the relocation reserve, cheaper on small heaps.
+  if (ZHeapGranuleSize == 0 || ZHeapGranuleSize == ZGranuleSize) {
+    return;
+  }
+
+  if (!is_power_of_2(ZHeapGranuleSize) ||
+      ZHeapGranuleSize < ZGranuleSizeMin ||
+      ZHeapGranuleSize > ZGranuleSize) {
+    vm_exit_during_initialization(err_msg("Invalid granule size (" SIZE_FORMAT "K), must be a power of two "
+                                          "between " SIZE_FORMAT "K and " SIZE_FORMAT "K",
+                                          ZHeapGranuleSize / K, ZGranuleSizeMin / K, ZGranuleSize / K));
+  }
+
+  ZGranuleSizeShift          = log2_intptr(ZHeapGranuleSize);
+  ZGranuleSize               = (size_t)1 << ZGranuleSizeShift;
+  ZPageSizeSmallShift        = ZGranuleSizeShift;
+  ZPageSizeSmall             = (size_t)1 << ZPageSizeSmallShift;
+  ZObjectSizeLimitSmall      = ZPageSizeSmall / 8;
+  ZObjectAlignmentLargeShift = (int)ZGranuleSizeShift;
+  ZObjectAlignmentLarge      = 1 << ZObjectAlignmentLargeShift;
+  ZMarkStripeShift           = ZGranuleSizeShift;
+}
+
 void ZHeuristics::set_medium_page_size() {
   // Set ZPageSizeMedium so that a medium page occupies at most 3.125% of the
   // max heap size. ZPageSizeMedium is initially set to 0, which means medium
@@ -28,6 +28,7 @@
 
 class ZHeuristics : public AllStatic {
 public:
+  static void set_granule_size();
   static void set_medium_page_size();
 
   static size_t max_reserve();
@@ -25,6 +25,7 @@
 #include "gc/z/zAddress.hpp"
 #include "gc/z/zBarrierSet.hpp"
 #include "gc/z/zCPU.hpp"
+#include "gc/z/zEventLog.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zHeuristics.hpp"
 #include "gc/z/zInitialize.hpp"
@@ -47,6 +48,7 @@ ZInitialize::ZInitialize(ZBarrierSet* barrier_set) {
   ZNUMA::initialize();
   ZCPU::initialize();
   ZStatValue::initialize();
+  ZEventLog::initialize();
   ZThreadLocalAllocBuffer::initialize();
   ZTracer::initialize();
   ZLargePages::initialize();
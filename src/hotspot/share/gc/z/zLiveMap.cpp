@@ -33,6 +33,7 @@
 
 static const ZStatCounter ZCounterMarkSeqNumResetContention("Contention", "Mark SeqNum Reset Contention", ZStatUnitOpsPerSecond);
 static const ZStatCounter ZCounterMarkSegmentResetContention("Contention", "Mark Segment Reset Contention", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterMarkLiveBitContention("Contention", "Mark Live Bit Contention", ZStatUnitOpsPerSecond);
 
 static size_t bitmap_size(uint32_t size, size_t nsegments) {
   // We need at least one bit per segment
@@ -124,6 +125,14 @@ void ZLiveMap::reset_segment(BitMap::idx_t segment) {
   assert(success, "Should never fail");
 }
 
+void ZLiveMap::set_contention(size_t index) const {
+  // Another thread updated the same bitmap word concurrently
+  ZStatInc(ZCounterMarkLiveBitContention);
+
+  log_trace(gc)("Mark live bit contention, thread: " PTR_FORMAT " (%s), map: " PTR_FORMAT ", index: " SIZE_FORMAT,
+                ZThread::id(), ZThread::name(), p2i(this), index);
+}
+
 void ZLiveMap::resize(uint32_t size) {
   const size_t new_bitmap_size = bitmap_size(size, nsegments);
   if (_bitmap.size() != new_bitmap_size) {
@@ -65,6 +65,7 @@ private:
 
   void reset(size_t index);
   void reset_segment(BitMap::idx_t segment);
+  void set_contention(size_t index) const;
 
   void iterate_segment(ObjectClosure* cl, BitMap::idx_t segment, uintptr_t page_start, size_t page_object_alignment_shift);
 
@@ -116,7 +116,13 @@ inline bool ZLiveMap::set(size_t index, bool finalizable, bool& inc_live) {
     reset_segment(segment);
   }
 
-  return _bitmap.par_set_bit_pair(index, finalizable, inc_live);
+  bool contention = false;
+  const bool success = _bitmap.par_set_bit_pair(index, finalizable, inc_live, contention);
+  if (contention) {
+    set_contention(index);
+  }
+
+  return success;
 }
 
 inline void ZLiveMap::inc_live(uint32_t objects, size_t bytes) {
@@ -47,6 +47,7 @@ public:
   ZReentrantLock();
 
   void lock();
+  bool try_lock();
   void unlock();
 
   bool is_owned() const;
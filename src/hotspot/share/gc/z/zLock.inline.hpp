@@ -59,6 +59,22 @@ inline void ZReentrantLock::lock() {
   _count++;
 }
 
+inline bool ZReentrantLock::try_lock() {
+  Thread* const thread = Thread::current();
+  Thread* const owner = Atomic::load(&_owner);
+
+  if (owner != thread) {
+    if (!_lock.try_lock()) {
+      return false;
+    }
+
+    Atomic::store(&_owner, thread);
+  }
+
+  _count++;
+  return true;
+}
+
 inline void ZReentrantLock::unlock() {
   assert(is_owned(), "Invalid owner");
   assert(_count > 0, "Invalid count");
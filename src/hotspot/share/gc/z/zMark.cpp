@@ -23,13 +23,15 @@
 
 #include "precompiled.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
+#include "gc/z/zArray.inline.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zMark.inline.hpp"
 #include "gc/z/zMarkCache.inline.hpp"
 #include "gc/z/zMarkStack.inline.hpp"
 #include "gc/z/zMarkTerminate.inline.hpp"
+#include "gc/z/zObjectSampleReferrers.inline.hpp"
 #include "gc/z/zOopClosures.inline.hpp"
-#include "gc/z/zPage.hpp"
+#include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageTable.inline.hpp"
 #include "gc/z/zRootsIterator.hpp"
 #include "gc/z/zStackWatermark.hpp"
@@ -41,6 +43,7 @@
 #include "gc/z/zWorkers.inline.hpp"
 #include "logging/log.hpp"
 #include "memory/iterator.inline.hpp"
+#include "oops/instanceKlass.hpp"
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
@@ -50,6 +53,7 @@
 #include "runtime/stackWatermark.hpp"
 #include "runtime/stackWatermarkSet.inline.hpp"
 #include "runtime/thread.hpp"
+#include "runtime/threadSMR.hpp"
 #include "utilities/align.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
@@ -61,12 +65,17 @@ static const ZStatSubPhase ZSubPhaseConcurrentMarkIdle("Concurrent Mark Idle");
 static const ZStatSubPhase ZSubPhaseConcurrentMarkTryTerminate("Concurrent Mark Try Terminate");
 static const ZStatSubPhase ZSubPhaseMarkTryComplete("Pause Mark Try Complete");
 
+static const ZStatCounter ZCounterMarkLeafObject("Memory", "Mark Leaf Object", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterMarkStackOverflow("Memory", "Mark Stack Overflow", ZStatUnitOpsPerSecond);
+
 ZMark::ZMark(ZWorkers* workers, ZPageTable* page_table) :
     _workers(workers),
     _page_table(page_table),
     _allocator(),
     _stripes(),
     _terminate(),
+    _overflow(),
+    _sample_referrers(),
     _work_terminateflush(true),
     _work_nproactiveflush(0),
     _work_nterminateflush(0),
@@ -123,40 +132,6 @@ void ZMark::prepare_mark() {
   }
 }
 
-class ZMarkRootsIteratorClosure : public ZRootsIteratorClosure {
-public:
-  virtual void do_oop(oop* p) {
-    ZBarrier::mark_barrier_on_root_oop_field(p);
-  }
-
-  virtual void do_oop(narrowOop* p) {
-    ShouldNotReachHere();
-  }
-};
-
-class ZMarkRootsTask : public ZTask {
-private:
-  ZMark* const              _mark;
-  ZRootsIterator            _roots;
-  ZMarkRootsIteratorClosure _cl;
-
-public:
-  ZMarkRootsTask(ZMark* mark) :
-      ZTask("ZMarkRootsTask"),
-      _mark(mark),
-      _roots(false /* visit_jvmti_weak_export */) {}
-
-  virtual void work() {
-    _roots.oops_do(&_cl);
-
-    // Flush and free worker stacks. Needed here since
-    // the set of workers executing during root scanning
-    // can be different from the set of workers executing
-    // during mark.
-    _mark->flush_and_free();
-  }
-};
-
 void ZMark::start() {
   // Verification
   if (ZVerifyMarking) {
@@ -166,9 +141,8 @@ void ZMark::start() {
   // Prepare for concurrent mark
   prepare_mark();
 
-  // Mark roots
-  ZMarkRootsTask task(this);
-  _workers->run_parallel(&task);
+  // Capture object samples to record referrers for
+  _sample_referrers.start();
 }
 
 void ZMark::prepare_work() {
@@ -203,7 +177,11 @@ void ZMark::push_partial_array(uintptr_t addr, size_t size, bool finalizable) {
   log_develop_trace(gc, marking)("Array push partial: " PTR_FORMAT " (" SIZE_FORMAT "), stripe: " SIZE_FORMAT,
                                  addr, size, _stripes.stripe_id(stripe));
 
-  stacks->push(&_allocator, &_stripes, stripe, entry, false /* publish */);
+  if (!stacks->push(&_allocator, &_stripes, stripe, entry, false /* publish */)) {
+    // Out of mark stack space, follow the partial array directly. This
+    // recursion is bounded, since each level halves the array size.
+    follow_array(addr, size, finalizable);
+  }
 }
 
 void ZMark::follow_small_array(uintptr_t addr, size_t size, bool finalizable) {
@@ -270,7 +248,58 @@ void ZMark::follow_partial_array(ZMarkStackEntry entry, bool finalizable) {
   follow_array(addr, size, finalizable);
 }
 
+class ZMarkObjectSampleOopClosure : public ZMarkBarrierOopClosure<false /* finalizable */> {
+private:
+  ZObjectSampleReferrers* const _referrers;
+  const uintptr_t               _base;
+  const uintptr_t               _referrer;
+
+public:
+  ZMarkObjectSampleOopClosure(ZObjectSampleReferrers* referrers, oop referrer) :
+      ZMarkBarrierOopClosure<false /* finalizable */>(),
+      _referrers(referrers),
+      _base(ZOop::to_address(referrer)),
+      _referrer(ZAddress::good(_base)) {}
+
+  virtual void do_oop(oop* p) {
+    ZMarkBarrierOopClosure<false /* finalizable */>::do_oop(p);
+
+    // The field has been healed by the barrier
+    const uintptr_t addr = ZOop::to_address(Atomic::load(p));
+    _referrers->discover(addr, _referrer, (uintptr_t)p - _base);
+  }
+
+  virtual void do_oop(narrowOop* p) {
+    ShouldNotReachHere();
+  }
+};
+
+void ZMark::follow_object_sampled(oop obj) {
+  ZMarkObjectSampleOopClosure cl(&_sample_referrers, obj);
+
+  if (!obj->is_objArray()) {
+    obj->oop_iterate(&cl);
+    return;
+  }
+
+  // Only arrays that are not split into partial arrays are followed
+  // here, since the referrer of a partial array is not known.
+  const objArrayOop array = objArrayOop(obj);
+  cl.do_klass(array->klass());
+  oop* const start = (oop*)array->base();
+  oop* const end = start + array->length();
+  for (oop* p = start; p < end; p++) {
+    cl.do_oop(p);
+  }
+}
+
 void ZMark::follow_array_object(objArrayOop obj, bool finalizable) {
+  if (!finalizable && _sample_referrers.is_active() &&
+      (size_t)obj->length() * oopSize <= ZMarkPartialArrayMinSize) {
+    follow_object_sampled(obj);
+    return;
+  }
+
   if (finalizable) {
     ZMarkBarrierOopClosure<true /* finalizable */> cl;
     cl.do_klass(obj->klass());
@@ -286,6 +315,11 @@ void ZMark::follow_array_object(objArrayOop obj, bool finalizable) {
 }
 
 void ZMark::follow_object(oop obj, bool finalizable) {
+  if (!finalizable && _sample_referrers.is_active()) {
+    follow_object_sampled(obj);
+    return;
+  }
+
   if (finalizable) {
     ZMarkBarrierOopClosure<true /* finalizable */> cl;
     obj->oop_iterate(&cl);
@@ -311,12 +345,66 @@ bool ZMark::try_mark_object(ZMarkCache* cache, uintptr_t addr, bool finalizable)
     // and alignment paddings can never be reclaimed.
     const size_t size = ZUtils::object_size(addr);
     const size_t aligned_size = align_up(size, page->object_alignment());
-    cache->inc_live(page, aligned_size);
+    if (cache != NULL) {
+      cache->inc_live(page, aligned_size);
+    } else {
+      page->inc_live(1, aligned_size);
+    }
   }
 
   return success;
 }
 
+bool ZMark::is_leaf_object(uintptr_t addr, bool finalizable) const {
+  const Klass* const klass = ZOop::from_address(addr)->klass();
+
+  if (klass->is_typeArray_klass()) {
+    // Primitive arrays have no references, and their klass is never unloaded
+    return true;
+  }
+
+  if (!klass->is_instance_klass()) {
+    return false;
+  }
+
+  const InstanceKlass* const ik = InstanceKlass::cast(klass);
+  if (ik->nonstatic_oop_map_count() > 0 ||
+      ik->is_reference_instance_klass() ||
+      ik->is_mirror_instance_klass() ||
+      ik->is_class_loader_instance_klass()) {
+    // Object has references, or needs special treatment when followed
+    return false;
+  }
+
+  if (!ClassUnloading) {
+    // Metadata is never visited when class unloading is disabled
+    return true;
+  }
+
+  // Following the object would also visit its class loader data. This can
+  // only be skipped if the class loader data has already been claimed, in
+  // which case someone else is responsible for marking through it.
+  const int claim = finalizable ? ClassLoaderData::_claim_finalizable : ClassLoaderData::_claim_strong;
+  return ik->class_loader_data()->claimed(claim);
+}
+
+bool ZMark::try_mark_leaf_object(uintptr_t addr, bool finalizable) {
+  if (!is_leaf_object(addr, finalizable)) {
+    // Object needs to be followed
+    return false;
+  }
+
+  // Mark the object directly instead of pushing it on the mark stack. GC
+  // workers account live bytes through their mark cache, while mutators
+  // have no cache and update the page directly.
+  ZMarkCache* const cache = ZThreadLocalData::mark_cache(Thread::current());
+  if (try_mark_object(cache, addr, finalizable)) {
+    ZStatInc(ZCounterMarkLeafObject);
+  }
+
+  return true;
+}
+
 void ZMark::mark_and_follow(ZMarkCache* cache, ZMarkStackEntry entry) {
   // Decode flags
   const bool finalizable = entry.finalizable();
@@ -348,6 +436,55 @@ void ZMark::mark_and_follow(ZMarkCache* cache, ZMarkStackEntry entry) {
   }
 }
 
+void ZMark::overflow_object(uintptr_t addr, bool follow, bool finalizable) {
+  // Mark the object in place and record it, so that it is followed when
+  // overflowed objects are rescanned. An object that was already marked
+  // is followed by whoever marked it, and does not need to be recorded.
+  ZMarkCache* const cache = ZThreadLocalData::mark_cache(Thread::current());
+  if (!try_mark_object(cache, addr, finalizable)) {
+    return;
+  }
+
+  ZStatInc(ZCounterMarkStackOverflow);
+
+  if (!follow && is_array(addr)) {
+    // Should only be marked, not followed
+    return;
+  }
+
+  _overflow.push(addr);
+}
+
+void ZMark::follow_overflowed_object(oop obj) {
+  const uintptr_t addr = ZOop::to_address(obj);
+  const ZPage* const page = _page_table->get(addr);
+  const bool finalizable = !page->is_object_strongly_live(addr);
+
+  if (is_array(addr)) {
+    follow_array_object(objArrayOop(obj), finalizable);
+  } else {
+    follow_object(obj, finalizable);
+  }
+}
+
+class ZMarkOverflowClosure : public ObjectClosure {
+private:
+  ZMark* const _mark;
+
+public:
+  ZMarkOverflowClosure(ZMark* mark) :
+      _mark(mark) {}
+
+  virtual void do_object(oop obj) {
+    _mark->follow_overflowed_object(obj);
+  }
+};
+
+bool ZMark::try_rescan_overflowed() {
+  ZMarkOverflowClosure cl(this);
+  return _overflow.rescan(&cl);
+}
+
 template <typename T>
 bool ZMark::drain(ZMarkStripe* stripe, ZMarkThreadLocalStacks* stacks, ZMarkCache* cache, T* timeout) {
   ZMarkStackEntry entry;
@@ -421,16 +558,48 @@ public:
   }
 };
 
+void ZMark::flush_targeted(ZMarkFlushAndFreeStacksClosure* cl) {
+  // Only handshake the Java threads that hold unpublished mark stacks.
+  // The check is racy, but a thread that is missed here will have its
+  // stacks flushed by a later flush, at the latest in mark end.
+  ZArray<JavaThread*> threads;
+  bool all = false;
+
+  ThreadsListHandle tlh;
+  JavaThreadIterator iter(tlh.list());
+  for (JavaThread* jt = iter.first(); jt != NULL; jt = iter.next()) {
+    if (!ZThreadLocalData::stacks(jt)->is_empty(&_stripes)) {
+      if ((size_t)threads.length() == ZMarkTargetedFlushMax) {
+        // Too many threads, handshake all threads
+        all = true;
+        break;
+      }
+
+      threads.append(jt);
+    }
+  }
+
+  if (all) {
+    Handshake::execute(cl);
+    return;
+  }
+
+  ZArrayIterator<JavaThread*> iter_threads(&threads);
+  for (JavaThread* jt; iter_threads.next(&jt);) {
+    Handshake::execute(cl, jt);
+  }
+}
+
 bool ZMark::flush(bool at_safepoint) {
   ZMarkFlushAndFreeStacksClosure cl(this);
   if (at_safepoint) {
     Threads::threads_do(&cl);
   } else {
-    Handshake::execute(&cl);
+    flush_targeted(&cl);
   }
 
   // Returns true if more work is available
-  return cl.flushed() || !_stripes.is_empty();
+  return cl.flushed() || !_stripes.is_empty() || !_overflow.is_empty();
 }
 
 bool ZMark::try_flush(volatile size_t* nflush) {
@@ -521,6 +690,11 @@ void ZMark::work_without_timeout(ZMarkCache* cache, ZMarkStripe* stripe, ZMarkTh
       continue;
     }
 
+    if (try_rescan_overflowed()) {
+      // Rescanned overflowed objects
+      continue;
+    }
+
     if (try_proactive_flush()) {
       // Work available
       continue;
@@ -586,22 +760,33 @@ void ZMark::work_with_timeout(ZMarkCache* cache, ZMarkStripe* stripe, ZMarkThrea
       continue;
     }
 
+    if (try_rescan_overflowed()) {
+      // Rescanned overflowed objects
+      continue;
+    }
+
     // Terminate
     break;
   }
 }
 
 void ZMark::work(uint64_t timeout_in_micros) {
-  ZMarkCache cache(_stripes.nstripes());
+  ZMarkCache cache;
   ZMarkStripe* const stripe = _stripes.stripe_for_worker(_nworkers, ZThread::worker_id());
   ZMarkThreadLocalStacks* const stacks = ZThreadLocalData::stacks(Thread::current());
 
+  // Install mark cache for leaf objects marked while following
+  ZThreadLocalData::set_mark_cache(Thread::current(), &cache);
+
   if (timeout_in_micros == 0) {
     work_without_timeout(&cache, stripe, stacks);
   } else {
     work_with_timeout(&cache, stripe, stacks, timeout_in_micros);
   }
 
+  // Uninstall mark cache before it goes out of scope
+  ZThreadLocalData::set_mark_cache(Thread::current(), NULL);
+
   // Make sure stacks have been flushed
   assert(stacks->is_empty(&_stripes), "Should be empty");
 
@@ -703,8 +888,9 @@ bool ZMark::try_complete() {
   ZMarkTask task(this, ZMarkCompleteTimeout);
   _workers->run_concurrent(&task);
 
-  // Successful if all stripes are empty
-  return _stripes.is_empty();
+  // Successful if all stripes are empty and there
+  // are no overflowed objects left to rescan
+  return _stripes.is_empty() && _overflow.is_empty();
 }
 
 bool ZMark::try_end() {
@@ -727,6 +913,18 @@ bool ZMark::end() {
     return false;
   }
 
+  // Hand over recorded referrers to the object samples
+  _sample_referrers.end();
+
+  // Report mark stack overflow, once per cycle
+  if (_overflow.npushed() > 0) {
+    log_warning(gc, marking)("Mark stack space exhausted (" SIZE_FORMAT "M), " SIZE_FORMAT " overflowed objects rescanned",
+                             ZMarkStackSpaceLimit / M, _overflow.npushed());
+  }
+
+  // Free overflow bitmaps
+  _overflow.reset();
+
   // Verification
   if (ZVerifyMarking) {
     verify_all_stacks_empty();
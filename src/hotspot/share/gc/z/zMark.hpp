@@ -24,19 +24,22 @@
 #ifndef SHARE_GC_Z_ZMARK_HPP
 #define SHARE_GC_Z_ZMARK_HPP
 
+#include "gc/z/zMarkOverflow.hpp"
 #include "gc/z/zMarkStack.hpp"
 #include "gc/z/zMarkStackAllocator.hpp"
 #include "gc/z/zMarkTerminate.hpp"
+#include "gc/z/zObjectSampleReferrers.hpp"
 #include "oops/oopsHierarchy.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 class Thread;
 class ZMarkCache;
+class ZMarkFlushAndFreeStacksClosure;
 class ZPageTable;
 class ZWorkers;
 
 class ZMark {
-  friend class ZMarkRootsTask;
+  friend class ZMarkOverflowClosure;
   friend class ZMarkTask;
   friend class ZMarkTryCompleteTask;
 
@@ -46,6 +49,8 @@ private:
   ZMarkStackAllocator _allocator;
   ZMarkStripeSet      _stripes;
   ZMarkTerminate      _terminate;
+  ZMarkOverflow       _overflow;
+  ZObjectSampleReferrers _sample_referrers;
   volatile bool       _work_terminateflush;
   volatile size_t     _work_nproactiveflush;
   volatile size_t     _work_nterminateflush;
@@ -66,8 +71,14 @@ private:
   void follow_partial_array(ZMarkStackEntry entry, bool finalizable);
   void follow_array_object(objArrayOop obj, bool finalizable);
   void follow_object(oop obj, bool finalizable);
+  void follow_object_sampled(oop obj);
   bool try_mark_object(ZMarkCache* cache, uintptr_t addr, bool finalizable);
+  bool is_leaf_object(uintptr_t addr, bool finalizable) const;
+  bool try_mark_leaf_object(uintptr_t addr, bool finalizable);
   void mark_and_follow(ZMarkCache* cache, ZMarkStackEntry entry);
+  void overflow_object(uintptr_t addr, bool follow, bool finalizable);
+  void follow_overflowed_object(oop obj);
+  bool try_rescan_overflowed();
 
   template <typename T> bool drain(ZMarkStripe* stripe,
                                    ZMarkThreadLocalStacks* stacks,
@@ -79,6 +90,7 @@ private:
                                              T* timeout);
   bool try_steal(ZMarkStripe* stripe, ZMarkThreadLocalStacks* stacks);
   void idle() const;
+  void flush_targeted(ZMarkFlushAndFreeStacksClosure* cl);
   bool flush(bool at_safepoint);
   bool try_proactive_flush();
   bool try_flush(volatile size_t* nflush);
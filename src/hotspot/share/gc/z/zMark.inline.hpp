@@ -34,11 +34,20 @@
 template <bool follow, bool finalizable, bool publish>
 inline void ZMark::mark_object(uintptr_t addr) {
   assert(ZAddress::is_marked(addr), "Should be marked");
+
+  if (try_mark_leaf_object(addr, finalizable)) {
+    // Object has no references to follow, and was marked directly
+    return;
+  }
+
   ZMarkThreadLocalStacks* const stacks = ZThreadLocalData::stacks(Thread::current());
   ZMarkStripe* const stripe = _stripes.stripe_for_addr(addr);
   ZMarkStackEntry entry(addr, follow, finalizable);
 
-  stacks->push(&_allocator, &_stripes, stripe, entry, publish);
+  if (!stacks->push(&_allocator, &_stripes, stripe, entry, publish)) {
+    // Out of mark stack space
+    overflow_object(addr, follow, finalizable);
+  }
 }
 
 #endif // SHARE_GC_Z_ZMARK_INLINE_HPP
@@ -24,19 +24,19 @@
 #include "precompiled.hpp"
 #include "gc/z/zMarkCache.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
-#include "utilities/powerOfTwo.hpp"
 
 ZMarkCacheEntry::ZMarkCacheEntry() :
     _page(NULL),
     _objects(0),
     _bytes(0) {}
 
-ZMarkCache::ZMarkCache(size_t nstripes) :
-    _shift(ZMarkStripeShift + exact_log2(nstripes)) {}
+ZMarkCache::ZMarkCache() {}
 
 ZMarkCache::~ZMarkCache() {
   // Evict all entries
-  for (size_t i = 0; i < ZMarkCacheSize; i++) {
-    _cache[i].evict();
+  for (size_t i = 0; i < ZMarkCacheSets; i++) {
+    for (size_t j = 0; j < ZMarkCacheWays; j++) {
+      _cache[i][j].evict();
+    }
   }
 }
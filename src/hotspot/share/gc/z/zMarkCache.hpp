@@ -38,17 +38,28 @@ private:
 public:
   ZMarkCacheEntry();
 
+  bool try_inc_live(ZPage* page, size_t bytes);
   void inc_live(ZPage* page, size_t bytes);
   void evict();
 };
 
+//
+// Two-way set associative cache of live objects/bytes per page. The
+// set is selected by hashing the page start, so that pages from all
+// stripes, and of all sizes, spread evenly over the sets. Way 0 holds
+// the most recently used entry of a set.
+//
 class ZMarkCache : public StackObj {
 private:
-  const size_t    _shift;
-  ZMarkCacheEntry _cache[ZMarkCacheSize];
+  static const size_t ZMarkCacheWays = 2;
+  static const size_t ZMarkCacheSets = ZMarkCacheSize / ZMarkCacheWays;
+
+  ZMarkCacheEntry _cache[ZMarkCacheSets][ZMarkCacheWays];
+
+  size_t set_index(ZPage* page) const;
 
 public:
-  ZMarkCache(size_t nstripes);
+  ZMarkCache();
   ~ZMarkCache();
 
   void inc_live(ZPage* page, size_t bytes);
@@ -26,6 +26,19 @@
 
 #include "gc/z/zMarkCache.hpp"
 #include "gc/z/zPage.inline.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+inline bool ZMarkCacheEntry::try_inc_live(ZPage* page, size_t bytes) {
+  if (_page != page) {
+    // Cache miss
+    return false;
+  }
+
+  // Cache hit
+  _objects++;
+  _bytes += bytes;
+  return true;
+}
 
 inline void ZMarkCacheEntry::inc_live(ZPage* page, size_t bytes) {
   if (_page == page) {
@@ -49,10 +62,34 @@ inline void ZMarkCacheEntry::evict() {
   }
 }
 
+inline size_t ZMarkCache::set_index(ZPage* page) const {
+  // Fibonacci hash of the granule index
+  const uint32_t granule = (uint32_t)(page->start() >> ZGranuleSizeShift);
+  const uint32_t hash = granule * 0x9E3779B9u;
+  return hash >> (32 - exact_log2(ZMarkCacheSets));
+}
+
 inline void ZMarkCache::inc_live(ZPage* page, size_t bytes) {
-  const size_t mask = ZMarkCacheSize - 1;
-  const size_t index = (page->start() >> _shift) & mask;
-  _cache[index].inc_live(page, bytes);
+  ZMarkCacheEntry* const set = _cache[set_index(page)];
+
+  if (set[0].try_inc_live(page, bytes)) {
+    // Hit in most recently used way
+    return;
+  }
+
+  if (set[1].try_inc_live(page, bytes)) {
+    // Hit in least recently used way, promote
+    const ZMarkCacheEntry tmp = set[0];
+    set[0] = set[1];
+    set[1] = tmp;
+    return;
+  }
+
+  // Miss, evict least recently used way and insert new entry
+  set[1].evict();
+  set[1] = set[0];
+  set[0] = ZMarkCacheEntry();
+  set[0].inc_live(page, bytes);
 }
 
 #endif // SHARE_GC_Z_ZMARKCACHE_INLINE_HPP
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/z/zAddress.inline.hpp"
+#include "gc/z/zArray.inline.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "gc/z/zGranuleMap.inline.hpp"
+#include "gc/z/zLock.inline.hpp"
+#include "gc/z/zMarkOverflow.hpp"
+#include "gc/z/zOop.inline.hpp"
+#include "memory/iterator.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/orderAccess.hpp"
+#include "utilities/align.hpp"
+#include "utilities/bitMap.inline.hpp"
+
+class ZMarkOverflowBitMap : public CHeapObj<mtGC> {
+private:
+  const uintptr_t _start;
+  CHeapBitMap     _map;
+  volatile bool   _queued;
+
+  BitMap::idx_t index(uintptr_t offset) const {
+    return (offset - _start) >> ZObjectAlignmentSmallShift;
+  }
+
+public:
+  ZMarkOverflowBitMap(uintptr_t start) :
+      _start(start),
+      _map(ZGranuleSize >> ZObjectAlignmentSmallShift, mtGC),
+      _queued(false) {}
+
+  uintptr_t start() const {
+    return _start;
+  }
+
+  void set(uintptr_t offset) {
+    _map.par_set_bit(index(offset));
+  }
+
+  bool try_queue() {
+    return !Atomic::load(&_queued) && !Atomic::cmpxchg(&_queued, false, true);
+  }
+
+  void dequeue() {
+    Atomic::store(&_queued, false);
+
+    // Make sure an object recorded after this point either is seen
+    // by the claiming below, or queues this bitmap again.
+    OrderAccess::fence();
+  }
+
+  void claim_and_iterate(ObjectClosure* cl) {
+    const BitMap::idx_t size = _map.size();
+    for (BitMap::idx_t i = _map.get_next_one_offset(0, size); i < size; i = _map.get_next_one_offset(i + 1, size)) {
+      if (_map.par_clear_bit(i)) {
+        // Claimed
+        const uintptr_t addr = ZAddress::good(_start + (i << ZObjectAlignmentSmallShift));
+        cl->do_object(ZOop::from_address(addr));
+      }
+    }
+  }
+};
+
+ZMarkOverflow::ZMarkOverflow() :
+    _lock(),
+    _map(ZAddressOffsetMax),
+    _bitmaps(),
+    _queue(),
+    _nqueued(0),
+    _npushed(0) {}
+
+bool ZMarkOverflow::is_empty() const {
+  return Atomic::load(&_nqueued) == 0;
+}
+
+size_t ZMarkOverflow::npushed() const {
+  return Atomic::load(&_npushed);
+}
+
+ZMarkOverflowBitMap* ZMarkOverflow::bitmap(uintptr_t offset) {
+  ZMarkOverflowBitMap* bitmap = _map.get_acquire(offset);
+  if (bitmap == NULL) {
+    ZLocker<ZLock> locker(&_lock);
+    bitmap = _map.get(offset);
+    if (bitmap == NULL) {
+      bitmap = new ZMarkOverflowBitMap(align_down(offset, ZGranuleSize));
+      _bitmaps.append(bitmap);
+      _map.release_put(offset, bitmap);
+    }
+  }
+
+  return bitmap;
+}
+
+void ZMarkOverflow::push(uintptr_t addr) {
+  const uintptr_t offset = ZAddress::offset(addr);
+  ZMarkOverflowBitMap* const bitmap = this->bitmap(offset);
+
+  // Record object
+  bitmap->set(offset);
+  Atomic::inc(&_npushed);
+
+  // Queue bitmap for rescan, unless already queued
+  if (bitmap->try_queue()) {
+    ZLocker<ZLock> locker(&_lock);
+    _queue.append(bitmap);
+    Atomic::store(&_nqueued, (size_t)_queue.length());
+  }
+}
+
+bool ZMarkOverflow::rescan(ObjectClosure* cl) {
+  ZMarkOverflowBitMap* bitmap = NULL;
+
+  {
+    ZLocker<ZLock> locker(&_lock);
+    if (_queue.is_empty()) {
+      // Nothing to rescan
+      return false;
+    }
+
+    bitmap = _queue.pop();
+    Atomic::store(&_nqueued, (size_t)_queue.length());
+  }
+
+  bitmap->dequeue();
+  bitmap->claim_and_iterate(cl);
+
+  return true;
+}
+
+void ZMarkOverflow::reset() {
+  assert(is_empty(), "Should be empty");
+
+  ZArrayIterator<ZMarkOverflowBitMap*> iter(&_bitmaps);
+  for (ZMarkOverflowBitMap* bitmap; iter.next(&bitmap);) {
+    _map.put(bitmap->start(), NULL);
+    delete bitmap;
+  }
+
+  _bitmaps.clear();
+  Atomic::store(&_npushed, (size_t)0);
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#ifndef SHARE_GC_Z_ZMARKOVERFLOW_HPP
+#define SHARE_GC_Z_ZMARKOVERFLOW_HPP
+
+#include "gc/z/zArray.hpp"
+#include "gc/z/zGranuleMap.hpp"
+#include "gc/z/zLock.hpp"
+#include "memory/allocation.hpp"
+
+class ObjectClosure;
+class ZMarkOverflowBitMap;
+
+//
+// Objects that could not be pushed on a mark stack, because the mark
+// stack space was exhausted, are marked in place and recorded here
+// instead. Each granule with overflowed objects gets a bitmap with one
+// bit per possible object start, and is queued for rescan. GC workers
+// later claim the recorded objects and follow them, which allows marking
+// to complete with a bounded amount of mark stack space.
+//
+class ZMarkOverflow {
+private:
+  ZLock                             _lock;
+  ZGranuleMap<ZMarkOverflowBitMap*> _map;
+  ZArray<ZMarkOverflowBitMap*>      _bitmaps;
+  ZArray<ZMarkOverflowBitMap*>      _queue;
+  volatile size_t                   _nqueued;
+  volatile size_t                   _npushed;
+
+  ZMarkOverflowBitMap* bitmap(uintptr_t offset);
+
+public:
+  ZMarkOverflow();
+
+  bool is_empty() const;
+  size_t npushed() const;
+
+  void push(uintptr_t addr);
+  bool rescan(ObjectClosure* cl);
+
+  void reset();
+};
+
+#endif // SHARE_GC_Z_ZMARKOVERFLOW_HPP
@@ -96,11 +96,9 @@ uintptr_t ZMarkStackSpace::expand_and_alloc_space(size_t size) {
   const size_t old_size = _end - _start;
   const size_t new_size = old_size + expand_size;
   if (new_size > ZMarkStackSpaceLimit) {
-    // Expansion limit reached. This is a fatal error since we
-    // currently can't recover from running out of mark stack space.
-    fatal("Mark stack space exhausted. Use -XX:ZMarkStackSpaceLimit=<size> to increase the "
-          "maximum number of bytes allocated for mark stacks. Current limit is " SIZE_FORMAT "M.",
-          ZMarkStackSpaceLimit / M);
+    // Expansion limit reached. Marking continues by recording
+    // objects that can't be pushed, and rescanning them later.
+    return 0;
   }
 
   log_debug(gc, marking)("Expanding mark stack space: " SIZE_FORMAT "M->" SIZE_FORMAT "M",
@@ -27,12 +27,14 @@
 #include "code/icBuffer.hpp"
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/barrierSetNMethod.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zNMethod.hpp"
 #include "gc/z/zNMethodData.hpp"
 #include "gc/z/zNMethodTable.hpp"
 #include "gc/z/zOopClosures.inline.hpp"
+#include "gc/z/zStat.hpp"
 #include "gc/z/zTask.hpp"
 #include "gc/z/zWorkers.hpp"
 #include "logging/log.hpp"
@@ -41,8 +43,11 @@
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/sweeper.hpp"
 #include "utilities/debug.hpp"
 
+static const ZStatCounter ZCounterNMethodHeal("Memory", "NMethod Heal", ZStatUnitOpsPerSecond);
+
 static ZNMethodData* gc_data(const nmethod* nm) {
   return nm->gc_data<ZNMethodData>();
 }
@@ -202,6 +207,12 @@ void ZNMethod::disarm(nmethod* nm) {
   bs->disarm(nm);
 }
 
+void ZNMethod::reset_hotness(nmethod* nm) {
+  if (ZNMethodHotness) {
+    nm->set_hotness_counter(NMethodSweeper::hotness_counter_reset_val());
+  }
+}
+
 void ZNMethod::nmethod_oops_do(nmethod* nm, OopClosure* cl) {
   // Process oops table
   {
@@ -273,6 +284,53 @@ void ZNMethod::oops_do(OopClosure* cl, bool should_disarm_nmethods) {
   ZNMethodTable::nmethods_do(&nmethod_cl);
 }
 
+class ZNMethodHealClosure : public NMethodClosure {
+public:
+  virtual void do_nmethod(nmethod* nm) {
+    ZReentrantLock* const lock = ZNMethod::lock_for_nmethod(nm);
+    if (!lock->try_lock()) {
+      // Being healed by the entry barrier
+      return;
+    }
+
+    if (nm->is_alive() && !nm->is_unloading() && ZNMethod::is_armed(nm)) {
+      // Heal oops and disarm
+      ZNMethodOopClosure cl;
+      ZNMethod::nmethod_oops_do(nm, &cl);
+      ZNMethod::disarm(nm);
+      ZStatInc(ZCounterNMethodHeal);
+    }
+
+    lock->unlock();
+  }
+};
+
+class ZNMethodHealTask : public ZTask {
+private:
+  ZNMethodHealClosure _cl;
+
+public:
+  ZNMethodHealTask() :
+      ZTask("ZNMethodHealTask"),
+      _cl() {
+    ZNMethodTable::nmethods_do_begin();
+  }
+
+  ~ZNMethodHealTask() {
+    ZNMethodTable::nmethods_do_end();
+  }
+
+  virtual void work() {
+    SuspendibleThreadSetJoiner sts_joiner;
+    ZNMethodTable::nmethods_do(&_cl);
+  }
+};
+
+void ZNMethod::heal(ZWorkers* workers) {
+  ZNMethodHealTask task;
+  workers->run_concurrent(&task);
+}
+
 class ZNMethodUnlinkClosure : public NMethodClosure {
 private:
   bool          _unloading_occurred;
@@ -47,6 +47,7 @@ public:
 
   static bool is_armed(nmethod* nm);
   static void disarm(nmethod* nm);
+  static void reset_hotness(nmethod* nm);
 
   static void nmethod_oops_do(nmethod* nm, OopClosure* cl);
 
@@ -54,6 +55,8 @@ public:
   static void oops_do_end();
   static void oops_do(OopClosure* cl, bool should_disarm_nmethods);
 
+  static void heal(ZWorkers* workers);
+
   static ZReentrantLock* lock_for_nmethod(nmethod* nm);
 
   static void unlink(ZWorkers* workers, bool unloading_occurred);
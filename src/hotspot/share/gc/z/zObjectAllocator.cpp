@@ -30,6 +30,7 @@
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zThread.inline.hpp"
+#include "gc/z/zThreadLocalData.hpp"
 #include "gc/z/zUtils.inline.hpp"
 #include "gc/z/zValue.inline.hpp"
 #include "logging/log.hpp"
@@ -42,6 +43,8 @@
 
 static const ZStatCounter ZCounterUndoObjectAllocationSucceeded("Memory", "Undo Object Allocation Succeeded", ZStatUnitOpsPerSecond);
 static const ZStatCounter ZCounterUndoObjectAllocationFailed("Memory", "Undo Object Allocation Failed", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterTLABPageTailFit("Memory", "TLAB Page Tail Fit", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterSmallPageTailWaste("Memory", "Small Page Tail Waste", ZStatUnitBytesPerSecond);
 
 ZObjectAllocator::ZObjectAllocator() :
     _use_per_cpu_shared_small_pages(ZHeuristics::use_per_cpu_shared_small_pages()),
@@ -118,6 +121,10 @@ uintptr_t ZObjectAllocator::alloc_object_in_shared_page(ZPage** shared_page,
 
         // Undo new page allocation
         undo_alloc_page(new_page);
+      } else if (page != NULL && page_type == ZPageTypeSmall) {
+        // The tail of the replaced page will never be used, count it
+        // only here since this is the one thread that replaced the page
+        ZStatInc(ZCounterSmallPageTailWaste, page->remaining());
       }
     }
   }
@@ -206,6 +213,83 @@ uintptr_t ZObjectAllocator::alloc_object(size_t size) {
   return alloc_object(size, flags);
 }
 
+uintptr_t ZObjectAllocator::alloc_tlab(size_t min_size, size_t requested_size, size_t* actual_size) {
+  assert(ZThread::is_java(), "Must be a Java thread");
+  assert(min_size <= requested_size, "Invalid size");
+  assert(requested_size <= ZObjectSizeLimitSmall, "TLAB too large");
+
+  ZPage* const page = Atomic::load_acquire(shared_small_page_addr());
+  if (page != NULL) {
+    // Try to fit the TLAB in what is left of the current shared page,
+    // shrinking it down to the minimum size if needed. This avoids
+    // allocating a new page while the tail of the current one could
+    // still be used.
+    const uintptr_t addr = page->alloc_object_atomic(min_size, requested_size, actual_size);
+    if (addr != 0) {
+      if (*actual_size < requested_size) {
+        ZStatInc(ZCounterTLABPageTailFit);
+      }
+
+      return addr;
+    }
+  }
+
+  // Allocate in a new page
+  const uintptr_t addr = alloc_object(requested_size);
+  if (addr != 0) {
+    *actual_size = requested_size;
+  }
+
+  return addr;
+}
+
+uintptr_t ZObjectAllocator::alloc_relocation_buffer(size_t min_size, size_t* actual_size, ZAllocationFlags flags) {
+  ZPage* const page = Atomic::load_acquire(shared_small_page_addr());
+  if (page != NULL) {
+    // Try to fit the buffer in what is left of the current shared page
+    const uintptr_t addr = page->alloc_object_atomic(min_size, ZRelocationBufferSize, actual_size);
+    if (addr != 0) {
+      return addr;
+    }
+  }
+
+  // Allocate in a new page
+  const uintptr_t addr = alloc_small_object_from_nonworker(ZRelocationBufferSize, flags);
+  if (addr != 0) {
+    *actual_size = ZRelocationBufferSize;
+  }
+
+  return addr;
+}
+
+uintptr_t ZObjectAllocator::alloc_object_in_relocation_buffer(size_t size, ZAllocationFlags flags) {
+  ZRelocationBuffer* const buffer = ZThreadLocalData::relocation_buffer(Thread::current());
+
+  if (buffer->is_valid()) {
+    // Allocate in current buffer
+    const uintptr_t addr = buffer->alloc_object(size);
+    if (addr != 0) {
+      return addr;
+    }
+
+    // Retire current buffer
+    ZStatRelocation::inc_buffer_waste(buffer->remaining());
+  }
+
+  // Install new buffer
+  size_t actual_size = 0;
+  const uintptr_t start = alloc_relocation_buffer(size, &actual_size, flags);
+  if (start == 0) {
+    buffer->reset();
+    return 0;
+  }
+
+  buffer->install(start, actual_size);
+  ZStatRelocation::inc_buffer_installed();
+
+  return buffer->alloc_object(size);
+}
+
 uintptr_t ZObjectAllocator::alloc_object_for_relocation(size_t size) {
   ZAllocationFlags flags;
   flags.set_relocation();
@@ -213,6 +297,10 @@ uintptr_t ZObjectAllocator::alloc_object_for_relocation(size_t size) {
 
   if (ZThread::is_worker()) {
     flags.set_worker_thread();
+  } else if (size <= ZRelocationBufferObjectMax) {
+    // Non-workers relocate small objects through a thread-local
+    // buffer, instead of contending on the shared small page.
+    return alloc_object_in_relocation_buffer(size, flags);
   }
 
   return alloc_object(size, flags);
@@ -271,6 +359,15 @@ bool ZObjectAllocator::undo_alloc_object(ZPage* page, uintptr_t addr, size_t siz
 }
 
 void ZObjectAllocator::undo_alloc_object_for_relocation(ZPage* page, uintptr_t addr, size_t size) {
+  if (!ZThread::is_worker() && size <= ZRelocationBufferObjectMax) {
+    ZRelocationBuffer* const buffer = ZThreadLocalData::relocation_buffer(Thread::current());
+    if (buffer->undo_alloc_object(addr, size)) {
+      ZStatInc(ZCounterUndoObjectAllocationSucceeded);
+      ZStatRelocation::inc_buffer_contention();
+      return;
+    }
+  }
+
   if (undo_alloc_object(page, addr, size)) {
     ZStatInc(ZCounterUndoObjectAllocationSucceeded);
   } else {
@@ -58,6 +58,8 @@ private:
   uintptr_t alloc_small_object_from_worker(size_t size, ZAllocationFlags flags);
   uintptr_t alloc_small_object(size_t size, ZAllocationFlags flags);
   uintptr_t alloc_object(size_t size, ZAllocationFlags flags);
+  uintptr_t alloc_relocation_buffer(size_t min_size, size_t* actual_size, ZAllocationFlags flags);
+  uintptr_t alloc_object_in_relocation_buffer(size_t size, ZAllocationFlags flags);
 
   bool undo_alloc_large_object(ZPage* page);
   bool undo_alloc_medium_object(ZPage* page, uintptr_t addr, size_t size);
@@ -70,6 +72,7 @@ public:
   ZObjectAllocator();
 
   uintptr_t alloc_object(size_t size);
+  uintptr_t alloc_tlab(size_t min_size, size_t requested_size, size_t* actual_size);
 
   uintptr_t alloc_object_for_relocation(size_t size);
   void undo_alloc_object_for_relocation(ZPage* page, uintptr_t addr, size_t size);
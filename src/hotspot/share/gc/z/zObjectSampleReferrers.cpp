@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/z/zAddress.inline.hpp"
+#include "gc/z/zObjectSampleReferrers.inline.hpp"
+#include "gc/z/zOop.inline.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.inline.hpp"
+#include "oops/access.inline.hpp"
+#include "runtime/safepoint.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/powerOfTwo.hpp"
+#include "utilities/macros.hpp"
+#if INCLUDE_JFR
+#include "jfr/leakprofiler/leakProfiler.hpp"
+#include "jfr/leakprofiler/sampling/objectSample.hpp"
+#include "jfr/leakprofiler/sampling/objectSampler.hpp"
+#endif
+
+ZObjectSampleReferrer::ZObjectSampleReferrer() :
+    _addr(0),
+    _referrer(0),
+    _offset(0) {}
+
+ZObjectSampleReferrers::ZObjectSampleReferrers() :
+    _table(NULL),
+    _size(0),
+    _min(UINTPTR_MAX),
+    _max(0) {}
+
+#if INCLUDE_JFR
+static uintptr_t sample_address(const ObjectSample* sample) {
+  // Load without keeping the sample object alive
+  oop* const p = const_cast<oop*>(sample->object_addr());
+  const oop obj = NativeAccess<ON_PHANTOM_OOP_REF | AS_NO_KEEPALIVE>::oop_load(p);
+  if (obj == NULL) {
+    return 0;
+  }
+
+  // Could be finalizable good, normalize to good
+  return ZAddress::good(ZOop::to_address(obj));
+}
+#endif
+
+void ZObjectSampleReferrers::start() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+  assert(!is_active(), "Invalid state");
+
+#if INCLUDE_JFR
+  if (!ZRecordObjectSampleReferrers || !LeakProfiler::is_running()) {
+    return;
+  }
+
+  const ObjectSampler* const sampler = ObjectSampler::sampler();
+  size_t nsamples = 0;
+  for (const ObjectSample* sample = sampler->last(); sample != NULL; sample = sample->next()) {
+    nsamples++;
+  }
+
+  if (nsamples == 0) {
+    return;
+  }
+
+  // Keep the table at most half full
+  _size = round_up_power_of_2(nsamples * 2);
+  _table = NEW_C_HEAP_ARRAY(ZObjectSampleReferrer, _size, mtGC);
+  for (size_t i = 0; i < _size; i++) {
+    ::new (_table + i) ZObjectSampleReferrer();
+  }
+
+  _min = UINTPTR_MAX;
+  _max = 0;
+
+  for (const ObjectSample* sample = sampler->last(); sample != NULL; sample = sample->next()) {
+    const uintptr_t addr = sample_address(sample);
+    if (addr == 0) {
+      // Dead sample
+      continue;
+    }
+
+    const size_t mask = _size - 1;
+    size_t index = ZHash::address_to_uint32(ZAddress::offset(addr)) & mask;
+    while (_table[index]._addr != 0 && _table[index]._addr != addr) {
+      index = (index + 1) & mask;
+    }
+
+    _table[index]._addr = addr;
+    _min = MIN2(_min, addr);
+    _max = MAX2(_max, addr);
+  }
+#endif
+}
+
+void ZObjectSampleReferrers::end() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+
+  if (!is_active()) {
+    return;
+  }
+
+#if INCLUDE_JFR
+  // The sampler could have been stopped, or replaced, while marking.
+  // Samples are looked up by their current address, so samples added
+  // or reused since mark start simply end up without a referrer.
+  if (LeakProfiler::is_running()) {
+    size_t nsamples = 0;
+    size_t nreferrers = 0;
+
+    for (ObjectSample* sample = ObjectSampler::sampler()->last(); sample != NULL; sample = sample->next()) {
+      const uintptr_t addr = sample_address(sample);
+      const ZObjectSampleReferrer* const entry = (addr != 0) ? find(addr) : NULL;
+      if (entry != NULL && entry->_referrer != 0) {
+        sample->set_referrer(ZOop::from_address(entry->_referrer), (int)entry->_offset);
+        nreferrers++;
+      } else {
+        sample->clear_referrer();
+      }
+      nsamples++;
+    }
+
+    log_debug(gc, marking)("Object Sample Referrers: " SIZE_FORMAT "/" SIZE_FORMAT, nreferrers, nsamples);
+  }
+#endif
+
+  FREE_C_HEAP_ARRAY(ZObjectSampleReferrer, _table);
+  _table = NULL;
+  _size = 0;
+}
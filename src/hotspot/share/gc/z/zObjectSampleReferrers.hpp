@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#ifndef SHARE_GC_Z_ZOBJECTSAMPLEREFERRERS_HPP
+#define SHARE_GC_Z_ZOBJECTSAMPLEREFERRERS_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class ZObjectSampleReferrer {
+  friend class ZObjectSampleReferrers;
+
+private:
+  uintptr_t          _addr;
+  volatile uintptr_t _referrer;
+  size_t             _offset;
+
+public:
+  ZObjectSampleReferrer();
+};
+
+//
+// Records, while marking, the object through which each JFR old object
+// sample was first discovered, and the offset of the referencing field.
+// The set of sample objects is captured in the mark start pause and the
+// referrers are handed over to the samples in the mark end pause, which
+// lets the leak profiler build reference chains without walking the heap.
+//
+class ZObjectSampleReferrers {
+private:
+  ZObjectSampleReferrer* _table;
+  size_t                 _size;
+  uintptr_t              _min;
+  uintptr_t              _max;
+
+  ZObjectSampleReferrer* find(uintptr_t addr) const;
+
+public:
+  ZObjectSampleReferrers();
+
+  bool is_active() const;
+
+  void start();
+  void discover(uintptr_t addr, uintptr_t referrer, size_t offset);
+  void end();
+};
+
+#endif // SHARE_GC_Z_ZOBJECTSAMPLEREFERRERS_HPP
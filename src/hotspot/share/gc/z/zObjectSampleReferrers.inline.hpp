@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#ifndef SHARE_GC_Z_ZOBJECTSAMPLEREFERRERS_INLINE_HPP
+#define SHARE_GC_Z_ZOBJECTSAMPLEREFERRERS_INLINE_HPP
+
+#include "gc/z/zAddress.inline.hpp"
+#include "gc/z/zHash.inline.hpp"
+#include "gc/z/zObjectSampleReferrers.hpp"
+#include "runtime/atomic.hpp"
+
+inline bool ZObjectSampleReferrers::is_active() const {
+  return _table != NULL;
+}
+
+inline ZObjectSampleReferrer* ZObjectSampleReferrers::find(uintptr_t addr) const {
+  const size_t mask = _size - 1;
+  size_t index = ZHash::address_to_uint32(ZAddress::offset(addr)) & mask;
+
+  for (;;) {
+    ZObjectSampleReferrer* const entry = _table + index;
+    if (entry->_addr == addr) {
+      return entry;
+    }
+
+    if (entry->_addr == 0) {
+      return NULL;
+    }
+
+    index = (index + 1) & mask;
+  }
+}
+
+inline void ZObjectSampleReferrers::discover(uintptr_t addr, uintptr_t referrer, size_t offset) {
+  if (addr < _min || addr > _max) {
+    // Not a sample object
+    return;
+  }
+
+  ZObjectSampleReferrer* const entry = find(addr);
+  if (entry == NULL || Atomic::load(&entry->_referrer) != 0) {
+    // Not a sample object, or already discovered
+    return;
+  }
+
+  if (Atomic::cmpxchg(&entry->_referrer, (uintptr_t)0, referrer) == 0) {
+    entry->_offset = offset;
+  }
+}
+
+#endif // SHARE_GC_Z_ZOBJECTSAMPLEREFERRERS_INLINE_HPP
@@ -35,6 +35,7 @@ ZPage::ZPage(const ZVirtualMemory& vmem, const ZPhysicalMemory& pmem) :
 ZPage::ZPage(uint8_t type, const ZVirtualMemory& vmem, const ZPhysicalMemory& pmem) :
     _type(type),
     _numa_id((uint8_t)-1),
+    _age(0),
     _seqnum(0),
     _virtual(vmem),
     _top(start()),
@@ -58,6 +59,7 @@ void ZPage::assert_initialized() const {
 
 void ZPage::reset() {
   _seqnum = ZGlobalSeqNum;
+  _age = 0;
   _top = start();
   _livemap.reset();
   _last_used = 0;
@@ -112,6 +114,12 @@ ZPage* ZPage::split_committed() {
   return new ZPage(vmem, pmem);
 }
 
+int ZPage::compare_start(ZPage** p1, ZPage** p2) {
+  const uintptr_t s1 = (*p1)->start();
+  const uintptr_t s2 = (*p2)->start();
+  return s1 < s2 ? -1 : (s1 > s2 ? 1 : 0);
+}
+
 void ZPage::print_on(outputStream* out) const {
   out->print_cr(" %-6s  " PTR_FORMAT " " PTR_FORMAT " " PTR_FORMAT " %s%s",
                 type_to_string(), start(), top(), end(),
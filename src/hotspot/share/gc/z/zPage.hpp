@@ -37,6 +37,7 @@ class ZPage : public CHeapObj<mtGC> {
 private:
   uint8_t            _type;
   uint8_t            _numa_id;
+  volatile uint8_t   _age;
   uint32_t           _seqnum;
   ZVirtualMemory     _virtual;
   volatile uintptr_t _top;
@@ -81,6 +82,9 @@ public:
   uint64_t last_used() const;
   void set_last_used();
 
+  uint8_t age() const;
+  void inherit_age(uint8_t age);
+
   void reset();
 
   ZPage* retype(uint8_t type);
@@ -88,6 +92,8 @@ public:
   ZPage* split(uint8_t type, size_t size);
   ZPage* split_committed();
 
+  static int compare_start(ZPage** p1, ZPage** p2);
+
   bool is_in(uintptr_t addr) const;
 
   bool is_marked() const;
@@ -103,6 +109,7 @@ public:
 
   uintptr_t alloc_object(size_t size);
   uintptr_t alloc_object_atomic(size_t size);
+  uintptr_t alloc_object_atomic(size_t min_size, size_t max_size, size_t* actual_size);
 
   bool undo_alloc_object(uintptr_t addr, size_t size);
   bool undo_alloc_object_atomic(uintptr_t addr, size_t size);
@@ -162,6 +162,27 @@ inline void ZPage::set_last_used() {
   _last_used = ceil(os::elapsedTime());
 }
 
+inline uint8_t ZPage::age() const {
+  // The age is the number of GC cycles the objects on this page have
+  // survived, not counting the current cycle. A page starts out with
+  // the age inherited from objects relocated to it, and then gets one
+  // cycle older for each GC cycle it survives.
+  const uint32_t survived = is_relocatable() ? ZGlobalSeqNum - _seqnum - 1 : 0;
+  return (uint8_t)MIN2<uint32_t>(Atomic::load(&_age) + survived, ZPageAgeMax);
+}
+
+inline void ZPage::inherit_age(uint8_t age) {
+  // Keep the age of the oldest objects relocated to this page
+  for (uint8_t prev_age = Atomic::load(&_age); prev_age < age;) {
+    const uint8_t res = Atomic::cmpxchg(&_age, prev_age, age);
+    if (res == prev_age) {
+      return;
+    }
+
+    prev_age = res;
+  }
+}
+
 inline bool ZPage::is_in(uintptr_t addr) const {
   const uintptr_t offset = ZAddress::offset(addr);
   return offset >= start() && offset < top();
@@ -259,6 +280,35 @@ inline uintptr_t ZPage::alloc_object_atomic(size_t size) {
   }
 }
 
+inline uintptr_t ZPage::alloc_object_atomic(size_t min_size, size_t max_size, size_t* actual_size) {
+  assert(is_allocating(), "Invalid state");
+
+  const size_t aligned_min_size = align_up(min_size, object_alignment());
+  const size_t aligned_max_size = align_up(max_size, object_alignment());
+  uintptr_t addr = top();
+
+  for (;;) {
+    // Allocate as much as possible, up to max size, of what is left
+    const size_t remaining = end() - addr;
+    if (remaining < aligned_min_size) {
+      // Not enough space left
+      return 0;
+    }
+
+    const size_t aligned_size = MIN2(remaining, aligned_max_size);
+    const uintptr_t new_top = addr + aligned_size;
+    const uintptr_t prev_top = Atomic::cmpxchg(&_top, addr, new_top);
+    if (prev_top == addr) {
+      // Success
+      *actual_size = aligned_size;
+      return ZAddress::good(addr);
+    }
+
+    // Retry
+    addr = prev_top;
+  }
+}
+
 inline bool ZPage::undo_alloc_object(uintptr_t addr, size_t size) {
   assert(is_allocating(), "Invalid state");
 
@@ -25,7 +25,9 @@
 #include "gc/shared/gcLogPrecious.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/z/zAddress.inline.hpp"
+#include "gc/z/zArray.inline.hpp"
 #include "gc/z/zCollectedHeap.hpp"
+#include "gc/z/zEventLog.hpp"
 #include "gc/z/zFuture.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zLock.inline.hpp"
@@ -41,14 +43,18 @@
 #include "gc/z/zWorkers.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/init.hpp"
 #include "runtime/java.hpp"
+#include "runtime/thread.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/ticks.hpp"
 
 static const ZStatCounter       ZCounterAllocationRate("Memory", "Allocation Rate", ZStatUnitBytesPerSecond);
 static const ZStatCounter       ZCounterPageCacheFlush("Memory", "Page Cache Flush", ZStatUnitBytesPerSecond);
+static const ZStatCounter       ZCounterPageCacheMerge("Memory", "Page Cache Merge", ZStatUnitBytesPerSecond);
 static const ZStatCriticalPhase ZCriticalPhaseAllocationStall("Allocation Stall");
 
 enum ZPageAllocationStall {
@@ -216,6 +222,7 @@ public:
 };
 
 bool ZPageAllocator::prime_cache(ZWorkers* workers, size_t size) {
+  const Ticks start = Ticks::now();
   ZAllocationFlags flags;
 
   flags.set_non_blocking();
@@ -234,6 +241,9 @@ bool ZPageAllocator::prime_cache(ZWorkers* workers, size_t size) {
 
   free_page(page, false /* reclaimed */);
 
+  const Tickspan duration = Ticks::now() - start;
+  log_info_p(gc, init)("Initial Capacity Commit: %.3fms", TimeHelper::counter_to_millis(duration.value()));
+
   return true;
 }
 
@@ -368,8 +378,12 @@ void ZPageAllocator::decrease_used(size_t size, bool reclaimed) {
 }
 
 bool ZPageAllocator::commit_page(ZPage* page) {
-  // Commit physical memory
-  return _physical.commit(page->physical_memory());
+  // Commit physical memory. Small pages are committed on the NUMA node
+  // of the allocating thread, so that they end up in the NUMA local page
+  // cache list of the node that requested them. Medium and large pages
+  // are interleaved at granule-level across all nodes.
+  const bool numa_local = page->type() == ZPageTypeSmall;
+  return _physical.commit(page->physical_memory(), numa_local);
 }
 
 void ZPageAllocator::uncommit_page(ZPage* page) {
@@ -485,6 +499,7 @@ static void check_out_of_memory_during_initialization() {
 }
 
 bool ZPageAllocator::alloc_page_stall(ZPageAllocation* allocation) {
+  const Ticks start = Ticks::now();
   ZStatTimer timer(ZCriticalPhaseAllocationStall);
   EventZAllocationStall event;
   ZPageAllocationStall result;
@@ -521,6 +536,13 @@ bool ZPageAllocator::alloc_page_stall(ZPageAllocation* allocation) {
   // Send event
   event.commit(allocation->type(), allocation->size());
 
+  // Record in event log
+  ResourceMark rm;
+  ZEventLog::log("Allocation Stall (%s) " SIZE_FORMAT "K, %.3fms, %s",
+                 Thread::current()->name(), allocation->size() / K,
+                 TimeHelper::counter_to_millis((Ticks::now() - start).value()),
+                 (result == ZPageAllocationStallSuccess) ? "Success" : "Failed");
+
   return (result == ZPageAllocationStallSuccess);
 }
 
@@ -547,6 +569,73 @@ bool ZPageAllocator::alloc_page_or_stall(ZPageAllocation* allocation) {
   return alloc_page_stall(allocation);
 }
 
+ZPage* ZPageAllocator::alloc_page_merge(ZPageAllocation* allocation) {
+  ZList<ZPage>* const pages = allocation->pages();
+  const size_t size = allocation->size();
+
+  ZArray<ZPage*> sorted;
+  size_t flushed = 0;
+
+  ZListIterator<ZPage> iter(pages);
+  for (ZPage* page; iter.next(&page);) {
+    flushed += page->size();
+    sorted.append(page);
+  }
+
+  if (flushed != size) {
+    // Flushed pages don't cover the allocation
+    return NULL;
+  }
+
+  if (allocation->flags().low_address()) {
+    // The flushed pages are not necessarily at a low address
+    return NULL;
+  }
+
+  sorted.sort(ZPage::compare_start);
+
+  for (int i = 1; i < sorted.length(); i++) {
+    const ZPage* const before = sorted.at(i - 1);
+    const ZPage* const after = sorted.at(i);
+
+    if (before->end() != after->start()) {
+      // Flushed pages are not adjacent
+      return NULL;
+    }
+
+    if (!before->physical_memory().is_before(after->physical_memory())) {
+      // Physical memory is not in the same order as the virtual
+      // memory it is mapped at. Since segments are kept in address
+      // order, the merged page would no longer know where each
+      // segment is mapped.
+      return NULL;
+    }
+  }
+
+  // The flushed pages form a contiguous and already mapped range of
+  // virtual memory, merge them in place into a new page.
+  const ZVirtualMemory vmem(sorted.first()->start(), size);
+  ZPhysicalMemory pmem;
+
+  ZArrayIterator<ZPage*> iter_sorted(&sorted);
+  for (ZPage* page; iter_sorted.next(&page);) {
+    ZPhysicalMemory& fmem = page->physical_memory();
+    pmem.add_segments(fmem);
+    fmem.remove_segments();
+
+    pages->remove(page);
+    _safe_delete(page);
+  }
+
+  allocation->set_flushed(flushed);
+
+  // Update statistics
+  ZStatInc(ZCounterPageCacheMerge, flushed);
+  log_debug(gc, heap)("Page Cache Merged: " SIZE_FORMAT "M", flushed / M);
+
+  return new ZPage(allocation->type(), vmem, pmem);
+}
+
 ZPage* ZPageAllocator::alloc_page_create(ZPageAllocation* allocation) {
   const size_t size = allocation->size();
 
@@ -612,6 +701,12 @@ ZPage* ZPageAllocator::alloc_page_finalize(ZPageAllocation* allocation) {
     return allocation->pages()->remove_first();
   }
 
+  // Medium path
+  ZPage* const merged = alloc_page_merge(allocation);
+  if (merged != NULL) {
+    return merged;
+  }
+
   // Slow path
   ZPage* const page = alloc_page_create(allocation);
   if (page == NULL) {
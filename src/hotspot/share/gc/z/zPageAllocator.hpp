@@ -89,6 +89,7 @@ private:
   bool alloc_page_common(ZPageAllocation* allocation);
   bool alloc_page_stall(ZPageAllocation* allocation);
   bool alloc_page_or_stall(ZPageAllocation* allocation);
+  ZPage* alloc_page_merge(ZPageAllocation* allocation);
   ZPage* alloc_page_create(ZPageAllocation* allocation);
   ZPage* alloc_page_finalize(ZPageAllocation* allocation);
   void alloc_page_failed(ZPageAllocation* allocation);
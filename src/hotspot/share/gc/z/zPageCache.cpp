@@ -22,6 +22,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/z/zArray.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zList.inline.hpp"
 #include "gc/z/zNUMA.hpp"
@@ -38,6 +39,10 @@ static const ZStatCounter ZCounterPageCacheHitL1("Memory", "Page Cache Hit L1",
 static const ZStatCounter ZCounterPageCacheHitL2("Memory", "Page Cache Hit L2", ZStatUnitOpsPerSecond);
 static const ZStatCounter ZCounterPageCacheHitL3("Memory", "Page Cache Hit L3", ZStatUnitOpsPerSecond);
 static const ZStatCounter ZCounterPageCacheMiss("Memory", "Page Cache Miss", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterPageCacheFlushContiguous("Memory", "Page Cache Flush Contiguous", ZStatUnitOpsPerSecond);
+
+// Max number of cached pages to scan when looking for a contiguous range
+static const int ZPageCacheFlushContiguousBudget = 512;
 
 class ZPageCacheFlushClosure : public StackObj {
   friend class ZPageCache;
@@ -199,6 +204,17 @@ void ZPageCache::free_page(ZPage* page) {
   }
 }
 
+void ZPageCache::remove_page(ZPage* page) {
+  const uint8_t type = page->type();
+  if (type == ZPageTypeSmall) {
+    _small.get(page->numa_id()).remove(page);
+  } else if (type == ZPageTypeMedium) {
+    _medium.remove(page);
+  } else {
+    _large.remove(page);
+  }
+}
+
 bool ZPageCache::flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to) {
   ZPage* const page = from->last();
   if (page == NULL || !cl->do_page(page)) {
@@ -270,7 +286,97 @@ public:
   }
 };
 
+bool ZPageCache::collect_list(const ZList<ZPage>* list, ZArray<ZPage*>* pages) const {
+  ZListIterator<ZPage> iter(list);
+  for (ZPage* page; iter.next(&page);) {
+    if (pages->length() >= ZPageCacheFlushContiguousBudget) {
+      // Budget reached
+      return false;
+    }
+
+    pages->append(page);
+  }
+
+  return true;
+}
+
+void ZPageCache::collect(ZArray<ZPage*>* pages) const {
+  // Small
+  ZPerNUMAConstIterator<ZList<ZPage> > iter_numa(&_small);
+  for (const ZList<ZPage>* list; iter_numa.next(&list);) {
+    if (!collect_list(list, pages)) {
+      return;
+    }
+  }
+
+  // Medium
+  if (!collect_list(&_medium, pages)) {
+    return;
+  }
+
+  // Large
+  collect_list(&_large, pages);
+}
+
+bool ZPageCache::flush_contiguous(size_t requested, ZList<ZPage>* to) {
+  // Collect a bounded number of cached pages, sorted by address
+  ZArray<ZPage*> pages;
+  collect(&pages);
+  pages.sort(ZPage::compare_start);
+
+  // Find the first window of adjacent pages covering the requested size,
+  // where dropping the lowest page would make it too small
+  int first = 0;
+  size_t flushed = 0;
+
+  for (int i = 0; i < pages.length(); i++) {
+    if (i > first && pages.at(i - 1)->end() != pages.at(i)->start()) {
+      // Not adjacent, start new window
+      first = i;
+      flushed = 0;
+    }
+
+    flushed += pages.at(i)->size();
+
+    while (flushed - pages.at(first)->size() >= requested) {
+      // Lowest page not needed, shrink window
+      flushed -= pages.at(first)->size();
+      first++;
+    }
+
+    if (flushed >= requested) {
+      // Flush window, highest address first, so that the
+      // lowest page ends up last in the list of pages.
+      for (int j = i; j >= first; j--) {
+        ZPage* const page = pages.at(j);
+        remove_page(page);
+        to->insert_last(page);
+      }
+
+      if (flushed > requested) {
+        // Overflushed, re-insert lower part of lowest page into the
+        // cache, which keeps the remaining pages adjacent.
+        const size_t overflushed = flushed - requested;
+        ZPage* const reinsert = to->last()->split(overflushed);
+        free_page(reinsert);
+      }
+
+      ZStatInc(ZCounterPageCacheFlushContiguous);
+      return true;
+    }
+  }
+
+  // Not found
+  return false;
+}
+
 void ZPageCache::flush_for_allocation(size_t requested, ZList<ZPage>* to) {
+  // Prefer flushing adjacent pages, which can be merged in place
+  // without having to be unmapped and remapped.
+  if (flush_contiguous(requested, to)) {
+    return;
+  }
+
   ZPageCacheFlushForAllocationClosure cl(requested);
   flush(&cl, to);
 }
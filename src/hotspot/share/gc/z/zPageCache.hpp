@@ -24,6 +24,7 @@
 #ifndef SHARE_GC_Z_ZPAGECACHE_HPP
 #define SHARE_GC_Z_ZPAGECACHE_HPP
 
+#include "gc/z/zArray.hpp"
 #include "gc/z/zList.hpp"
 #include "gc/z/zPage.hpp"
 #include "gc/z/zValue.hpp"
@@ -45,10 +46,15 @@ private:
   ZPage* alloc_oversized_large_page(size_t size);
   ZPage* alloc_oversized_page(size_t size);
 
+  void remove_page(ZPage* page);
+
   bool flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_list(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList<ZPage> >* from, ZList<ZPage>* to);
   void flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to);
+  bool collect_list(const ZList<ZPage>* list, ZArray<ZPage*>* pages) const;
+  void collect(ZArray<ZPage*>* pages) const;
+  bool flush_contiguous(size_t requested, ZList<ZPage>* to);
 
 public:
   ZPageCache();
@@ -27,10 +27,12 @@
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageTable.inline.hpp"
 #include "runtime/orderAccess.hpp"
+#include "utilities/bitMap.inline.hpp"
 #include "utilities/debug.hpp"
 
 ZPageTable::ZPageTable() :
-    _map(ZAddressOffsetMax) {}
+    _map(ZAddressOffsetMax),
+    _summary(ZAddressOffsetMax >> ZGranuleSizeShift, mtGC) {}
 
 void ZPageTable::insert(ZPage* page) {
   const uintptr_t offset = page->start();
@@ -42,6 +44,12 @@ void ZPageTable::insert(ZPage* page) {
 
   assert(_map.get(offset) == NULL, "Invalid entry");
   _map.put(offset, size, page);
+
+  // Make sure the entries are visible before
+  // the page can be found by iterators.
+  OrderAccess::storestore();
+
+  _summary.par_set_bit(summary_index(offset));
 }
 
 void ZPageTable::remove(ZPage* page) {
@@ -49,5 +57,6 @@ void ZPageTable::remove(ZPage* page) {
   const size_t size = page->size();
 
   assert(_map.get(offset) == page, "Invalid entry");
+  _summary.par_clear_bit(summary_index(offset));
   _map.put(offset, size, NULL);
 }
@@ -26,6 +26,7 @@
 
 #include "gc/z/zGranuleMap.hpp"
 #include "memory/allocation.hpp"
+#include "utilities/bitMap.hpp"
 
 class ZPage;
 
@@ -35,6 +36,9 @@ class ZPageTable {
 
 private:
   ZGranuleMap<ZPage*> _map;
+  CHeapBitMap         _summary;
+
+  static BitMap::idx_t summary_index(uintptr_t offset);
 
 public:
   ZPageTable();
@@ -45,10 +49,13 @@ public:
   void remove(ZPage* page);
 };
 
+// Iterates over all pages in the page table. Only the granules where a
+// page starts are visited, by scanning the summary bitmap of page starts,
+// instead of walking every granule of the address space.
 class ZPageTableIterator : public StackObj {
 private:
-  ZGranuleMapIterator<ZPage*> _iter;
-  ZPage*                      _prev;
+  const ZPageTable* const _table;
+  BitMap::idx_t           _next;
 
 public:
   ZPageTableIterator(const ZPageTable* page_table);
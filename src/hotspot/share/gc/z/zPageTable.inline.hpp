@@ -26,7 +26,13 @@
 
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zGranuleMap.inline.hpp"
+#include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageTable.hpp"
+#include "utilities/bitMap.inline.hpp"
+
+inline BitMap::idx_t ZPageTable::summary_index(uintptr_t offset) {
+  return offset >> ZGranuleSizeShift;
+}
 
 inline ZPage* ZPageTable::get(uintptr_t addr) const {
   assert(!ZAddress::is_null(addr), "Invalid address");
@@ -34,14 +40,26 @@ inline ZPage* ZPageTable::get(uintptr_t addr) const {
 }
 
 inline ZPageTableIterator::ZPageTableIterator(const ZPageTable* page_table) :
-    _iter(&page_table->_map),
-    _prev(NULL) {}
+    _table(page_table),
+    _next(0) {}
 
 inline bool ZPageTableIterator::next(ZPage** page) {
-  for (ZPage* entry; _iter.next(&entry);) {
-    if (entry != NULL && entry != _prev) {
+  const BitMap::idx_t end = _table->_summary.size();
+
+  while (_next < end) {
+    const BitMap::idx_t index = _table->_summary.get_next_one_offset(_next, end);
+    if (index >= end) {
+      break;
+    }
+
+    _next = index + 1;
+
+    // The entry can be stale if the page was concurrently removed
+    const uintptr_t offset = index << ZGranuleSizeShift;
+    ZPage* const entry = _table->_map.get(offset);
+    if (entry != NULL && entry->start() == offset) {
       // Next page found
-      *page = _prev = entry;
+      *page = entry;
       return true;
     }
   }
@@ -73,6 +73,13 @@ size_t ZPhysicalMemory::size() const {
   return size;
 }
 
+bool ZPhysicalMemory::is_before(const ZPhysicalMemory& pmem) const {
+  // Segments are kept in address order, so the segments of pmem can
+  // only be added after our segments without being reordered if they
+  // all start at or above the end of our last segment.
+  return is_null() || pmem.is_null() || _segments.last().end() <= pmem.segment(0).start();
+}
+
 void ZPhysicalMemory::insert_segment(int index, uintptr_t start, size_t size, bool committed) {
   _segments.insert_before(index, ZPhysicalMemorySegment(start, size, committed));
 }
@@ -310,7 +317,7 @@ void ZPhysicalMemoryManager::free(const ZPhysicalMemory& pmem) {
   }
 }
 
-bool ZPhysicalMemoryManager::commit(ZPhysicalMemory& pmem) {
+bool ZPhysicalMemoryManager::commit(ZPhysicalMemory& pmem, bool numa_local) {
   // Commit segments
   for (int i = 0; i < pmem.nsegments(); i++) {
     const ZPhysicalMemorySegment& segment = pmem.segment(i);
@@ -320,7 +327,7 @@ bool ZPhysicalMemoryManager::commit(ZPhysicalMemory& pmem) {
     }
 
     // Commit segment
-    const size_t committed = _backing.commit(segment.start(), segment.size());
+    const size_t committed = _backing.commit(segment.start(), segment.size(), numa_local);
     if (!pmem.commit_segment(i, committed)) {
       // Failed or partially failed
       return false;
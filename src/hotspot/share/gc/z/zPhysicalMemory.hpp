@@ -67,6 +67,8 @@ public:
   int nsegments() const;
   const ZPhysicalMemorySegment& segment(int index) const;
 
+  bool is_before(const ZPhysicalMemory& pmem) const;
+
   void add_segments(const ZPhysicalMemory& pmem);
   void remove_segments();
 
@@ -101,7 +103,7 @@ public:
   void alloc(ZPhysicalMemory& pmem, size_t size);
   void free(const ZPhysicalMemory& pmem);
 
-  bool commit(ZPhysicalMemory& pmem);
+  bool commit(ZPhysicalMemory& pmem, bool numa_local = false);
   bool uncommit(ZPhysicalMemory& pmem);
 
   void pretouch(uintptr_t offset, size_t size) const;
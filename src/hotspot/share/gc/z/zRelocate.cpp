@@ -25,9 +25,10 @@
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zForwarding.inline.hpp"
-#include "gc/z/zHeap.hpp"
+#include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zNMethod.hpp"
 #include "gc/z/zOopClosures.inline.hpp"
-#include "gc/z/zPage.hpp"
+#include "gc/z/zPage.inline.hpp"
 #include "gc/z/zRelocate.hpp"
 #include "gc/z/zRelocationSet.inline.hpp"
 #include "gc/z/zRootsIterator.hpp"
@@ -43,40 +44,21 @@ static const ZStatCounter ZCounterRelocationContention("Contention", "Relocation
 ZRelocate::ZRelocate(ZWorkers* workers) :
     _workers(workers) {}
 
-class ZRelocateRootsIteratorClosure : public ZRootsIteratorClosure {
-public:
-  virtual void do_oop(oop* p) {
-    ZBarrier::relocate_barrier_on_root_oop_field(p);
-  }
-
-  virtual void do_oop(narrowOop* p) {
-    ShouldNotReachHere();
-  }
-};
-
-class ZRelocateRootsTask : public ZTask {
-private:
-  ZRootsIterator                _roots;
-  ZRelocateRootsIteratorClosure _cl;
-
-public:
-  ZRelocateRootsTask() :
-      ZTask("ZRelocateRootsTask"),
-      _roots(true /* visit_jvmti_weak_export */) {}
-
-  virtual void work() {
-    // During relocation we need to visit the JVMTI
-    // export weak roots to rehash the JVMTI tag map
-    _roots.oops_do(&_cl);
+void ZRelocate::inherit_age(ZForwarding* forwarding, uintptr_t to_good, ZPage** target) const {
+  if (*target != NULL && (*target)->is_in(to_good)) {
+    // Age already inherited by this target page
+    return;
   }
-};
 
-void ZRelocate::start() {
-  ZRelocateRootsTask task;
-  _workers->run_parallel(&task);
+  // The relocated objects have now survived one more cycle. Since
+  // relocated objects are allocated contiguously, this only needs
+  // to be done once for each target page the forwarding is
+  // relocated into, and not once for every object.
+  *target = ZHeap::heap()->page(to_good);
+  (*target)->inherit_age(MIN2(forwarding->age() + 1, (int)ZPageAgeMax));
 }
 
-uintptr_t ZRelocate::relocate_object_inner(ZForwarding* forwarding, uintptr_t from_index, uintptr_t from_offset) const {
+uintptr_t ZRelocate::relocate_object_inner(ZForwarding* forwarding, uintptr_t from_index, uintptr_t from_offset, ZPage** target) const {
   ZForwardingCursor cursor;
 
   // Lookup forwarding entry
@@ -110,6 +92,7 @@ uintptr_t ZRelocate::relocate_object_inner(ZForwarding* forwarding, uintptr_t fr
   const uintptr_t to_offset_final = forwarding->insert(from_index, to_offset, &cursor);
   if (to_offset_final == to_offset) {
     // Relocation succeeded
+    inherit_age(forwarding, to_good, target);
     return to_offset;
   }
 
@@ -125,10 +108,10 @@ uintptr_t ZRelocate::relocate_object_inner(ZForwarding* forwarding, uintptr_t fr
   return to_offset_final;
 }
 
-uintptr_t ZRelocate::relocate_object(ZForwarding* forwarding, uintptr_t from_addr) const {
+uintptr_t ZRelocate::relocate_object(ZForwarding* forwarding, uintptr_t from_addr, ZPage** target) const {
   const uintptr_t from_offset = ZAddress::offset(from_addr);
   const uintptr_t from_index = (from_offset - forwarding->start()) >> forwarding->object_alignment_shift();
-  const uintptr_t to_offset = relocate_object_inner(forwarding, from_index, from_offset);
+  const uintptr_t to_offset = relocate_object_inner(forwarding, from_index, from_offset, target);
 
   if (from_offset == to_offset) {
     // In-place forwarding, pin page
@@ -138,6 +121,11 @@ uintptr_t ZRelocate::relocate_object(ZForwarding* forwarding, uintptr_t from_add
   return ZAddress::good(to_offset);
 }
 
+uintptr_t ZRelocate::relocate_object(ZForwarding* forwarding, uintptr_t from_addr) const {
+  ZPage* target = NULL;
+  return relocate_object(forwarding, from_addr, &target);
+}
+
 uintptr_t ZRelocate::forward_object(ZForwarding* forwarding, uintptr_t from_addr) const {
   const uintptr_t from_offset = ZAddress::offset(from_addr);
   const uintptr_t from_index = (from_offset - forwarding->start()) >> forwarding->object_alignment_shift();
@@ -153,14 +141,16 @@ class ZRelocateObjectClosure : public ObjectClosure {
 private:
   ZRelocate* const   _relocate;
   ZForwarding* const _forwarding;
+  ZPage*             _target;
 
 public:
   ZRelocateObjectClosure(ZRelocate* relocate, ZForwarding* forwarding) :
       _relocate(relocate),
-      _forwarding(forwarding) {}
+      _forwarding(forwarding),
+      _target(NULL) {}
 
   virtual void do_object(oop o) {
-    _relocate->relocate_object(_forwarding, ZOop::to_address(o));
+    _relocate->relocate_object(_forwarding, ZOop::to_address(o), &_target);
   }
 };
 
@@ -216,5 +206,13 @@ public:
 bool ZRelocate::relocate(ZRelocationSet* relocation_set) {
   ZRelocateTask task(this, relocation_set);
   _workers->run_concurrent(&task);
+
+  // Heal and disarm nmethods once relocation is done, so that mutators
+  // rarely need to take the entry barrier slow path until the next
+  // cycle. This is done after relocating, to not delay relocation, and
+  // as a separate task, to not keep the nmethod table iteration open
+  // during relocation.
+  ZNMethod::heal(_workers);
+
   return !task.failed();
 }
@@ -29,6 +29,7 @@
 #include "memory/allocation.hpp"
 
 class ZForwarding;
+class ZPage;
 
 class ZRelocate {
   friend class ZRelocateTask;
@@ -37,16 +38,17 @@ private:
   ZWorkers* const _workers;
 
   ZForwarding* forwarding_for_page(ZPage* page) const;
-  uintptr_t relocate_object_inner(ZForwarding* forwarding, uintptr_t from_index, uintptr_t from_offset) const;
+  void inherit_age(ZForwarding* forwarding, uintptr_t to_good, ZPage** target) const;
+  uintptr_t relocate_object_inner(ZForwarding* forwarding, uintptr_t from_index, uintptr_t from_offset, ZPage** target) const;
   bool work(ZRelocationSetParallelIterator* iter);
 
 public:
   ZRelocate(ZWorkers* workers);
 
+  uintptr_t relocate_object(ZForwarding* forwarding, uintptr_t from_addr, ZPage** target) const;
   uintptr_t relocate_object(ZForwarding* forwarding, uintptr_t from_addr) const;
   uintptr_t forward_object(ZForwarding* forwarding, uintptr_t from_addr) const;
 
-  void start();
   bool relocate(ZRelocationSet* relocation_set);
 };
 
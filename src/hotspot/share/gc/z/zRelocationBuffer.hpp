@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#ifndef SHARE_GC_Z_ZRELOCATIONBUFFER_HPP
+#define SHARE_GC_Z_ZRELOCATIONBUFFER_HPP
+
+#include "gc/z/zGlobals.hpp"
+#include "memory/allocation.hpp"
+#include "utilities/align.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+//
+// Thread-local buffer used by non-worker threads when relocating small
+// objects, carved out of a shared small page. The buffer is only valid
+// in the GC cycle it was installed in, since the page it was carved out
+// of is retired, and could be selected for relocation, in the next cycle.
+//
+class ZRelocationBuffer {
+private:
+  uintptr_t _top;
+  uint32_t  _remaining;
+  uint32_t  _seqnum;
+
+public:
+  ZRelocationBuffer() :
+      _top(0),
+      _remaining(0),
+      _seqnum(0) {}
+
+  bool is_valid() const {
+    return _seqnum == ZGlobalSeqNum;
+  }
+
+  size_t remaining() const {
+    return _remaining;
+  }
+
+  void install(uintptr_t start, size_t size) {
+    assert(size <= ZRelocationBufferSize, "Invalid size");
+    _top = start;
+    _remaining = (uint32_t)size;
+    _seqnum = ZGlobalSeqNum;
+  }
+
+  void reset() {
+    _top = 0;
+    _remaining = 0;
+    _seqnum = 0;
+  }
+
+  uintptr_t alloc_object(size_t size) {
+    assert(is_valid(), "Invalid buffer");
+    const size_t aligned_size = align_up(size, ZObjectAlignmentSmall);
+    if (aligned_size > remaining()) {
+      // Not enough space left
+      return 0;
+    }
+
+    const uintptr_t addr = _top;
+    _top += aligned_size;
+    _remaining -= (uint32_t)aligned_size;
+    return addr;
+  }
+
+  bool undo_alloc_object(uintptr_t addr, size_t size) {
+    const size_t aligned_size = align_up(size, ZObjectAlignmentSmall);
+    if (!is_valid() || addr + aligned_size != _top) {
+      // Not the last object allocated in this buffer
+      return false;
+    }
+
+    _top = addr;
+    _remaining += (uint32_t)aligned_size;
+    return true;
+  }
+};
+
+#endif // SHARE_GC_Z_ZRELOCATIONBUFFER_HPP
@@ -41,6 +41,12 @@ ZRelocationSetSelectorGroupStats::ZRelocationSetSelectorGroupStats() :
     _compacting_from(0),
     _compacting_to(0) {}
 
+ZRelocationSetSelectorAgeStats::ZRelocationSetSelectorAgeStats() :
+    _npages(0),
+    _total(0),
+    _live(0),
+    _relocated(0) {}
+
 ZRelocationSetSelectorGroup::ZRelocationSetSelectorGroup(const char* name,
                                                          uint8_t page_type,
                                                          size_t page_size,
@@ -204,11 +210,28 @@ void ZRelocationSetSelectorGroup::select() {
 ZRelocationSetSelector::ZRelocationSetSelector() :
     _small("Small", ZPageTypeSmall, ZPageSizeSmall, ZObjectSizeLimitSmall),
     _medium("Medium", ZPageTypeMedium, ZPageSizeMedium, ZObjectSizeLimitMedium),
-    _large("Large", ZPageTypeLarge, 0 /* page_size */, 0 /* object_size_limit */) {}
+    _large("Large", ZPageTypeLarge, 0 /* page_size */, 0 /* object_size_limit */),
+    _age() {}
+
+void ZRelocationSetSelector::register_page_age(ZPage* page, size_t live) {
+  ZRelocationSetSelectorAgeStats& stats = _age[page->age()];
+  stats._npages++;
+  stats._total += page->size();
+  stats._live += live;
+}
+
+void ZRelocationSetSelector::register_relocated_age(ZPage* const* pages, size_t npages) {
+  for (size_t i = 0; i < npages; i++) {
+    const ZPage* const page = pages[i];
+    _age[page->age()]._relocated += page->live_bytes();
+  }
+}
 
 void ZRelocationSetSelector::register_live_page(ZPage* page) {
   const uint8_t type = page->type();
 
+  register_page_age(page, page->live_bytes());
+
   if (type == ZPageTypeSmall) {
     _small.register_live_page(page);
   } else if (type == ZPageTypeMedium) {
@@ -221,6 +244,8 @@ void ZRelocationSetSelector::register_live_page(ZPage* page) {
 void ZRelocationSetSelector::register_garbage_page(ZPage* page) {
   const uint8_t type = page->type();
 
+  register_page_age(page, 0 /* live */);
+
   if (type == ZPageTypeSmall) {
     _small.register_garbage_page(page);
   } else if (type == ZPageTypeMedium) {
@@ -248,8 +273,20 @@ void ZRelocationSetSelector::select(ZRelocationSet* relocation_set) {
   relocation_set->populate(_medium.selected(), _medium.nselected(),
                            _small.selected(), _small.nselected());
 
-  // Send event
+  // Update age statistics
+  register_relocated_age(_medium.selected(), _medium.nselected());
+  register_relocated_age(_small.selected(), _small.nselected());
+
+  // Send events
   event.commit(total(), empty(), compacting_from(), compacting_to());
+
+  for (uint8_t age = 0; age <= ZPageAgeMax; age++) {
+    const ZRelocationSetSelectorAgeStats& stats = _age[age];
+    if (stats.npages() > 0) {
+      EventZRelocationSetAge event_age;
+      event_age.commit(age, stats.npages(), stats.total(), stats.live(), stats.relocated());
+    }
+  }
 }
 
 ZRelocationSetSelectorStats ZRelocationSetSelector::stats() const {
@@ -257,5 +294,8 @@ ZRelocationSetSelectorStats ZRelocationSetSelector::stats() const {
   stats._small = _small.stats();
   stats._medium = _medium.stats();
   stats._large = _large.stats();
+  for (uint8_t age = 0; age <= ZPageAgeMax; age++) {
+    stats._age[age] = _age[age];
+  }
   return stats;
 }
@@ -25,6 +25,7 @@
 #define SHARE_GC_Z_ZRELOCATIONSETSELECTOR_HPP
 
 #include "gc/z/zArray.hpp"
+#include "gc/z/zGlobals.hpp"
 #include "memory/allocation.hpp"
 
 class ZPage;
@@ -54,6 +55,25 @@ public:
   size_t compacting_to() const;
 };
 
+class ZRelocationSetSelectorAgeStats {
+  friend class ZRelocationSetSelector;
+
+private:
+  size_t _npages;
+  size_t _total;
+  size_t _live;
+  size_t _relocated;
+
+public:
+  ZRelocationSetSelectorAgeStats();
+
+  size_t npages() const;
+  size_t total() const;
+  size_t live() const;
+  size_t relocated() const;
+  double survival_rate() const;
+};
+
 class ZRelocationSetSelectorStats {
   friend class ZRelocationSetSelector;
 
@@ -61,11 +81,13 @@ private:
   ZRelocationSetSelectorGroupStats _small;
   ZRelocationSetSelectorGroupStats _medium;
   ZRelocationSetSelectorGroupStats _large;
+  ZRelocationSetSelectorAgeStats   _age[ZPageAgeMax + 1];
 
 public:
   const ZRelocationSetSelectorGroupStats& small() const;
   const ZRelocationSetSelectorGroupStats& medium() const;
   const ZRelocationSetSelectorGroupStats& large() const;
+  const ZRelocationSetSelectorAgeStats& age(uint8_t age) const;
 };
 
 class ZRelocationSetSelectorGroup {
@@ -105,9 +127,13 @@ public:
 
 class ZRelocationSetSelector : public StackObj {
 private:
-  ZRelocationSetSelectorGroup _small;
-  ZRelocationSetSelectorGroup _medium;
-  ZRelocationSetSelectorGroup _large;
+  ZRelocationSetSelectorGroup    _small;
+  ZRelocationSetSelectorGroup    _medium;
+  ZRelocationSetSelectorGroup    _large;
+  ZRelocationSetSelectorAgeStats _age[ZPageAgeMax + 1];
+
+  void register_page_age(ZPage* page, size_t live);
+  void register_relocated_age(ZPage* const* pages, size_t npages);
 
   size_t total() const;
   size_t empty() const;
@@ -54,6 +54,26 @@ inline size_t ZRelocationSetSelectorGroupStats::compacting_to() const {
   return _compacting_to;
 }
 
+inline size_t ZRelocationSetSelectorAgeStats::npages() const {
+  return _npages;
+}
+
+inline size_t ZRelocationSetSelectorAgeStats::total() const {
+  return _total;
+}
+
+inline size_t ZRelocationSetSelectorAgeStats::live() const {
+  return _live;
+}
+
+inline size_t ZRelocationSetSelectorAgeStats::relocated() const {
+  return _relocated;
+}
+
+inline double ZRelocationSetSelectorAgeStats::survival_rate() const {
+  return percent_of(_live, _total);
+}
+
 inline const ZRelocationSetSelectorGroupStats& ZRelocationSetSelectorStats::small() const {
   return _small;
 }
@@ -66,6 +86,11 @@ inline const ZRelocationSetSelectorGroupStats& ZRelocationSetSelectorStats::larg
   return _large;
 }
 
+inline const ZRelocationSetSelectorAgeStats& ZRelocationSetSelectorStats::age(uint8_t age) const {
+  assert(age <= ZPageAgeMax, "Invalid age");
+  return _age[age];
+}
+
 inline ZPage* const* ZRelocationSetSelectorGroup::selected() const {
   return _sorted_pages;
 }
@@ -44,7 +44,6 @@
 #include "memory/iterator.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
-#include "prims/jvmtiExport.hpp"
 #include "prims/resolvedMethodTable.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/safepoint.hpp"
@@ -54,9 +53,6 @@
 #include "runtime/vmThread.hpp"
 #include "utilities/debug.hpp"
 
-static const ZStatSubPhase ZSubPhasePauseRoots("Pause Roots");
-static const ZStatSubPhase ZSubPhasePauseRootsJVMTIWeakExport("Pause Roots JVMTIWeakExport");
-
 static const ZStatSubPhase ZSubPhaseConcurrentRootsSetup("Concurrent Roots Setup");
 static const ZStatSubPhase ZSubPhaseConcurrentRoots("Concurrent Roots");
 static const ZStatSubPhase ZSubPhaseConcurrentRootsTeardown("Concurrent Roots Teardown");
@@ -65,26 +61,9 @@ static const ZStatSubPhase ZSubPhaseConcurrentRootsClassLoaderDataGraph("Concurr
 static const ZStatSubPhase ZSubPhaseConcurrentRootsJavaThreads("Concurrent Roots Java Threads");
 static const ZStatSubPhase ZSubPhaseConcurrentRootsCodeCache("Concurrent Roots CodeCache");
 
-static const ZStatSubPhase ZSubPhasePauseWeakRootsSetup("Pause Weak Roots Setup");
-static const ZStatSubPhase ZSubPhasePauseWeakRoots("Pause Weak Roots");
-static const ZStatSubPhase ZSubPhasePauseWeakRootsTeardown("Pause Weak Roots Teardown");
-static const ZStatSubPhase ZSubPhasePauseWeakRootsJVMTIWeakExport("Pause Weak Roots JVMTIWeakExport");
-
 static const ZStatSubPhase ZSubPhaseConcurrentWeakRoots("Concurrent Weak Roots");
 static const ZStatSubPhase ZSubPhaseConcurrentWeakRootsOopStorageSet("Concurrent Weak Roots OopStorageSet");
 
-template <typename T, void (T::*F)(ZRootsIteratorClosure*)>
-ZSerialOopsDo<T, F>::ZSerialOopsDo(T* iter) :
-    _iter(iter),
-    _claimed(false) {}
-
-template <typename T, void (T::*F)(ZRootsIteratorClosure*)>
-void ZSerialOopsDo<T, F>::oops_do(ZRootsIteratorClosure* cl) {
-  if (!_claimed && Atomic::cmpxchg(&_claimed, false, true) == false) {
-    (_iter->*F)(cl);
-  }
-}
-
 template <typename T, void (T::*F)(ZRootsIteratorClosure*)>
 ZParallelOopsDo<T, F>::ZParallelOopsDo(T* iter) :
     _iter(iter),
@@ -100,33 +79,6 @@ void ZParallelOopsDo<T, F>::oops_do(ZRootsIteratorClosure* cl) {
   }
 }
 
-template <typename T, void (T::*F)(BoolObjectClosure*, ZRootsIteratorClosure*)>
-ZSerialWeakOopsDo<T, F>::ZSerialWeakOopsDo(T* iter) :
-    _iter(iter),
-    _claimed(false) {}
-
-template <typename T, void (T::*F)(BoolObjectClosure*, ZRootsIteratorClosure*)>
-void ZSerialWeakOopsDo<T, F>::weak_oops_do(BoolObjectClosure* is_alive, ZRootsIteratorClosure* cl) {
-  if (!_claimed && Atomic::cmpxchg(&_claimed, false, true) == false) {
-    (_iter->*F)(is_alive, cl);
-  }
-}
-
-template <typename T, void (T::*F)(BoolObjectClosure*, ZRootsIteratorClosure*)>
-ZParallelWeakOopsDo<T, F>::ZParallelWeakOopsDo(T* iter) :
-    _iter(iter),
-    _completed(false) {}
-
-template <typename T, void (T::*F)(BoolObjectClosure*, ZRootsIteratorClosure*)>
-void ZParallelWeakOopsDo<T, F>::weak_oops_do(BoolObjectClosure* is_alive, ZRootsIteratorClosure* cl) {
-  if (!_completed) {
-    (_iter->*F)(is_alive, cl);
-    if (!_completed) {
-      _completed = true;
-    }
-  }
-}
-
 ZJavaThreadsIterator::ZJavaThreadsIterator() :
     _threads(),
     _claimed(0) {}
@@ -141,25 +93,6 @@ void ZJavaThreadsIterator::threads_do(ThreadClosure* cl) {
   }
 }
 
-ZRootsIterator::ZRootsIterator(bool visit_jvmti_weak_export) :
-    _visit_jvmti_weak_export(visit_jvmti_weak_export),
-    _jvmti_weak_export(this) {
-  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
-}
-
-void ZRootsIterator::do_jvmti_weak_export(ZRootsIteratorClosure* cl) {
-  ZStatTimer timer(ZSubPhasePauseRootsJVMTIWeakExport);
-  AlwaysTrueClosure always_alive;
-  JvmtiExport::weak_oops_do(&always_alive, cl);
-}
-
-void ZRootsIterator::oops_do(ZRootsIteratorClosure* cl) {
-  ZStatTimer timer(ZSubPhasePauseRoots);
-  if (_visit_jvmti_weak_export) {
-    _jvmti_weak_export.oops_do(cl);
-  }
-}
-
 ZConcurrentRootsIterator::ZConcurrentRootsIterator(int cld_claim) :
     _oop_storage_set_iter(),
     _java_threads_iter(),
@@ -230,31 +163,6 @@ void ZConcurrentRootsIterator::oops_do(ZRootsIteratorClosure* cl) {
   }
 }
 
-ZWeakRootsIterator::ZWeakRootsIterator() :
-    _jvmti_weak_export(this) {
-  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
-  ZStatTimer timer(ZSubPhasePauseWeakRootsSetup);
-}
-
-ZWeakRootsIterator::~ZWeakRootsIterator() {
-  ZStatTimer timer(ZSubPhasePauseWeakRootsTeardown);
-}
-
-void ZWeakRootsIterator::do_jvmti_weak_export(BoolObjectClosure* is_alive, ZRootsIteratorClosure* cl) {
-  ZStatTimer timer(ZSubPhasePauseWeakRootsJVMTIWeakExport);
-  JvmtiExport::weak_oops_do(is_alive, cl);
-}
-
-void ZWeakRootsIterator::weak_oops_do(BoolObjectClosure* is_alive, ZRootsIteratorClosure* cl) {
-  ZStatTimer timer(ZSubPhasePauseWeakRoots);
-  _jvmti_weak_export.weak_oops_do(is_alive, cl);
-}
-
-void ZWeakRootsIterator::oops_do(ZRootsIteratorClosure* cl) {
-  AlwaysTrueClosure always_alive;
-  weak_oops_do(&always_alive, cl);
-}
-
 ZConcurrentWeakRootsIterator::ZConcurrentWeakRootsIterator() :
     _oop_storage_set_iter(),
     _oop_storage_set(this) {
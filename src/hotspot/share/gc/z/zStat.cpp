@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "gc/z/zCollectedHeap.hpp"
 #include "gc/z/zCPU.inline.hpp"
+#include "gc/z/zEventLog.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zLargePages.inline.hpp"
@@ -615,11 +616,14 @@ const char* ZStatPhase::name() const {
 }
 
 ZStatPhaseCycle::ZStatPhaseCycle(const char* name) :
-    ZStatPhase("Collector", name) {}
+    ZStatPhase("Collector", name),
+    _cpu_sampler("CPU", name, ZStatUnitTime) {}
 
 void ZStatPhaseCycle::register_start(const Ticks& start) const {
   timer()->register_gc_start(start);
 
+  ZStatCPUTime::at_cycle_start();
+
   ZTracer::tracer()->report_gc_start(ZCollectedHeap::heap()->gc_cause(), start);
 
   ZCollectedHeap::heap()->print_heap_before_gc();
@@ -627,6 +631,10 @@ void ZStatPhaseCycle::register_start(const Ticks& start) const {
 
   log_info(gc, start)("Garbage Collection (%s)",
                        GCCause::to_string(ZCollectedHeap::heap()->gc_cause()));
+
+  ZEventLog::log("Garbage Collection (%s) Start, Used: " SIZE_FORMAT "M",
+                 GCCause::to_string(ZCollectedHeap::heap()->gc_cause()),
+                 ZHeap::heap()->used() / M);
 }
 
 void ZStatPhaseCycle::register_end(const Ticks& start, const Ticks& end) const {
@@ -639,8 +647,10 @@ void ZStatPhaseCycle::register_end(const Ticks& start, const Ticks& end) const {
 
   const Tickspan duration = end - start;
   ZStatSample(_sampler, duration.value());
+  ZStatSample(_cpu_sampler, ZStatCPUTime::to_ticks(ZStatCPUTime::cycle()));
 
   ZStatLoad::print();
+  ZStatCPUTime::print(duration);
   ZStatMMU::print();
   ZStatMark::print();
   ZStatNMethods::print();
@@ -653,12 +663,19 @@ void ZStatPhaseCycle::register_end(const Ticks& start, const Ticks& end) const {
                GCCause::to_string(ZCollectedHeap::heap()->gc_cause()),
                ZSIZE_ARGS(ZStatHeap::used_at_mark_start()),
                ZSIZE_ARGS(ZStatHeap::used_at_relocate_end()));
+
+  ZEventLog::log("Garbage Collection (%s) End, %.3fms, Used: " SIZE_FORMAT "M->" SIZE_FORMAT "M",
+                 GCCause::to_string(ZCollectedHeap::heap()->gc_cause()),
+                 TimeHelper::counter_to_millis(duration.value()),
+                 ZStatHeap::used_at_mark_start() / M,
+                 ZStatHeap::used_at_relocate_end() / M);
 }
 
 Tickspan ZStatPhasePause::_max;
 
 ZStatPhasePause::ZStatPhasePause(const char* name) :
-    ZStatPhase("Phase", name) {}
+    ZStatPhase("Phase", name),
+    _cpu_sampler("CPU", name, ZStatUnitTime) {}
 
 const Tickspan& ZStatPhasePause::max() {
   return _max;
@@ -667,6 +684,8 @@ const Tickspan& ZStatPhasePause::max() {
 void ZStatPhasePause::register_start(const Ticks& start) const {
   timer()->register_gc_pause_start(name(), start);
 
+  ZStatCPUTime::at_phase_start(true /* pause */);
+
   LogTarget(Debug, gc, phases, start) log;
   log_start(log);
 }
@@ -676,6 +695,7 @@ void ZStatPhasePause::register_end(const Ticks& start, const Ticks& end) const {
 
   const Tickspan duration = end - start;
   ZStatSample(_sampler, duration.value());
+  ZStatSample(_cpu_sampler, ZStatCPUTime::to_ticks(ZStatCPUTime::at_phase_end(true /* pause */)));
 
   // Track max pause time
   if (_max < duration) {
@@ -687,14 +707,19 @@ void ZStatPhasePause::register_end(const Ticks& start, const Ticks& end) const {
 
   LogTarget(Info, gc, phases) log;
   log_end(log, duration);
+
+  ZEventLog::log("%s %.3fms", name(), TimeHelper::counter_to_millis(duration.value()));
 }
 
 ZStatPhaseConcurrent::ZStatPhaseConcurrent(const char* name) :
-    ZStatPhase("Phase", name) {}
+    ZStatPhase("Phase", name),
+    _cpu_sampler("CPU", name, ZStatUnitTime) {}
 
 void ZStatPhaseConcurrent::register_start(const Ticks& start) const {
   timer()->register_gc_concurrent_start(name(), start);
 
+  ZStatCPUTime::at_phase_start(false /* pause */);
+
   LogTarget(Debug, gc, phases, start) log;
   log_start(log);
 }
@@ -704,9 +729,12 @@ void ZStatPhaseConcurrent::register_end(const Ticks& start, const Ticks& end) co
 
   const Tickspan duration = end - start;
   ZStatSample(_sampler, duration.value());
+  ZStatSample(_cpu_sampler, ZStatCPUTime::to_ticks(ZStatCPUTime::at_phase_end(false /* pause */)));
 
   LogTarget(Info, gc, phases) log;
   log_end(log, duration);
+
+  ZEventLog::log("%s %.3fms", name(), TimeHelper::counter_to_millis(duration.value()));
 }
 
 ZStatSubPhase::ZStatSubPhase(const char* name) :
@@ -1036,8 +1064,12 @@ void ZStatCycle::at_start() {
 }
 
 void ZStatCycle::at_end(GCCause::Cause cause, double boost_factor) {
+  const double time_since_last = ZStatCycle::time_since_last();
   _end_of_last = Ticks::now();
 
+  // Record GC CPU overhead since the end of the last cycle
+  ZStatCPUTime::at_cycle_end(time_since_last);
+
   if (cause == GCCause::_z_warmup) {
     _nwarmup_cycles++;
   }
@@ -1079,6 +1111,93 @@ double ZStatCycle::time_since_last() {
   return time_since_last.seconds();
 }
 
+//
+// Stat CPU time
+//
+jlong     ZStatCPUTime::_phase_start = 0;
+jlong     ZStatCPUTime::_cycle = 0;
+NumberSeq ZStatCPUTime::_overhead(0.7 /* alpha */);
+
+class ZStatCPUTimeClosure : public ThreadClosure {
+private:
+  jlong _total;
+
+public:
+  ZStatCPUTimeClosure() :
+      _total(0) {}
+
+  virtual void do_thread(Thread* thread) {
+    const jlong cpu_time = os::thread_cpu_time(thread);
+    if (cpu_time > 0) {
+      _total += cpu_time;
+    }
+  }
+
+  jlong total() const {
+    return _total;
+  }
+};
+
+jlong ZStatCPUTime::gc_threads(bool pause) {
+  if (!os::is_thread_cpu_time_supported()) {
+    return 0;
+  }
+
+  ZStatCPUTimeClosure cl;
+  ZCollectedHeap::heap()->gc_threads_do(&cl);
+
+  if (pause) {
+    // Pauses are executed by the VM thread
+    assert(Thread::current()->is_VM_thread(), "Should be VM thread");
+    cl.do_thread(Thread::current());
+  }
+
+  return cl.total();
+}
+
+void ZStatCPUTime::at_cycle_start() {
+  _cycle = 0;
+}
+
+void ZStatCPUTime::at_cycle_end(double seconds_since_last) {
+  // Calculate the share of the available CPU time spent by GC threads
+  // since the end of the last cycle
+  const double available = seconds_since_last * NANOSECS_PER_SEC * os::initial_active_processor_count();
+  if (available > 0.0) {
+    _overhead.add(percent_of((double)_cycle, available));
+  }
+}
+
+void ZStatCPUTime::at_phase_start(bool pause) {
+  _phase_start = gc_threads(pause);
+}
+
+jlong ZStatCPUTime::at_phase_end(bool pause) {
+  const jlong cpu_time = MAX2(gc_threads(pause) - _phase_start, (jlong)0);
+  _cycle += cpu_time;
+  return cpu_time;
+}
+
+uint64_t ZStatCPUTime::to_ticks(jlong nanos) {
+  return (uint64_t)(nanos * ((double)os::elapsed_frequency() / NANOSECS_PER_SEC));
+}
+
+jlong ZStatCPUTime::cycle() {
+  return _cycle;
+}
+
+const AbsSeq& ZStatCPUTime::overhead() {
+  return _overhead;
+}
+
+void ZStatCPUTime::print(const Tickspan& duration) {
+  const double cycle_ms = (double)_cycle / NANOSECS_PER_MILLISEC;
+  const double wall_ms = TimeHelper::counter_to_millis(duration.value());
+  log_info(gc, cpu)("GC CPU Time: %.3fms (%.1f CPUs during cycle), Overhead: %.1f%% (Avg: %.1f%%)",
+                    cycle_ms, wall_ms > 0.0 ? cycle_ms / wall_ms : 0.0,
+                    _overhead.last(), _overhead.davg());
+}
+
 //
 // Stat load
 //
@@ -1130,15 +1249,35 @@ void ZStatMark::print() {
 //
 ZRelocationSetSelectorStats ZStatRelocation::_stats;
 bool                        ZStatRelocation::_success;
+volatile size_t             ZStatRelocation::_buffer_installed;
+volatile size_t             ZStatRelocation::_buffer_waste;
+volatile size_t             ZStatRelocation::_buffer_contention;
 
 void ZStatRelocation::set_at_select_relocation_set(const ZRelocationSetSelectorStats& stats) {
   _stats = stats;
+
+  // Reset relocation buffer counters
+  Atomic::store(&_buffer_installed, (size_t)0);
+  Atomic::store(&_buffer_waste, (size_t)0);
+  Atomic::store(&_buffer_contention, (size_t)0);
 }
 
 void ZStatRelocation::set_at_relocate_end(bool success) {
   _success = success;
 }
 
+void ZStatRelocation::inc_buffer_installed() {
+  Atomic::inc(&_buffer_installed);
+}
+
+void ZStatRelocation::inc_buffer_waste(size_t size) {
+  Atomic::add(&_buffer_waste, size);
+}
+
+void ZStatRelocation::inc_buffer_contention() {
+  Atomic::inc(&_buffer_contention);
+}
+
 void ZStatRelocation::print(const char* name, const ZRelocationSetSelectorGroupStats& group) {
   const size_t total = _stats.small().total() + _stats.medium().total() + _stats.large().total();
 
@@ -1151,14 +1290,67 @@ void ZStatRelocation::print(const char* name, const ZRelocationSetSelectorGroupS
                       ZSIZE_ARGS_WITH_MAX(group.compacting_to(), total));
 }
 
+void ZStatRelocation::print_age() {
+  // Aggregate young (age 0) and old (age 1+) pages
+  size_t young_total = 0;
+  size_t young_live = 0;
+  size_t old_total = 0;
+  size_t old_live = 0;
+  size_t old_relocated = 0;
+  size_t relocated = 0;
+
+  for (uint8_t age = 0; age <= ZPageAgeMax; age++) {
+    const ZRelocationSetSelectorAgeStats& stats = _stats.age(age);
+    if (stats.npages() == 0) {
+      continue;
+    }
+
+    log_debug(gc, reloc)("Age %2u%s Pages: " SIZE_FORMAT ", Total: " SIZE_FORMAT "M, Live: " SIZE_FORMAT "M (%.1f%% survived), Relocated: " SIZE_FORMAT "M",
+                         age, age == ZPageAgeMax ? "+:" : ": ",
+                         stats.npages(), stats.total() / M, stats.live() / M,
+                         stats.survival_rate(), stats.relocated() / M);
+
+    if (age == 0) {
+      young_total += stats.total();
+      young_live += stats.live();
+    } else {
+      old_total += stats.total();
+      old_live += stats.live();
+      old_relocated += stats.relocated();
+    }
+
+    relocated += stats.relocated();
+  }
+
+  log_info(gc, reloc)("Page Age Survival: %.1f%% young, %.1f%% old, Relocated Old: " SIZE_FORMAT "M (%.0f%%)",
+                      percent_of(young_live, young_total),
+                      percent_of(old_live, old_total),
+                      old_relocated / M,
+                      percent_of(old_relocated, relocated));
+}
+
 void ZStatRelocation::print() {
   print("Small", _stats.small());
   if (ZPageSizeMedium != 0) {
     print("Medium", _stats.medium());
   }
   print("Large", _stats.large());
+  print_age();
+
+  log_info(gc, reloc)("Relocation Buffers: " SIZE_FORMAT " installed, " SIZE_FORMAT "K wasted, " SIZE_FORMAT " contended",
+                      Atomic::load(&_buffer_installed),
+                      Atomic::load(&_buffer_waste) / K,
+                      Atomic::load(&_buffer_contention));
 
   log_info(gc, reloc)("Relocation: %s", _success ? "Successful" : "Incomplete");
+
+  ZEventLog::log("Relocation Set: Small " SIZE_FORMAT " pages " SIZE_FORMAT "M->" SIZE_FORMAT "M, "
+                 "Medium " SIZE_FORMAT " pages " SIZE_FORMAT "M->" SIZE_FORMAT "M, "
+                 "Large " SIZE_FORMAT "M empty, %s",
+                 _stats.small().npages(), _stats.small().compacting_from() / M, _stats.small().compacting_to() / M,
+                 _stats.medium().npages(), _stats.medium().compacting_from() / M, _stats.medium().compacting_to() / M,
+                 _stats.large().empty() / M,
+                 _success ? "Successful" : "Incomplete");
 }
 
 //
@@ -1173,14 +1365,25 @@ void ZStatNMethods::print() {
 //
 // Stat metaspace
 //
+size_t ZStatMetaspace::_released;
+
+void ZStatMetaspace::set_at_purge(size_t released) {
+  _released = released;
+}
+
 void ZStatMetaspace::print() {
   log_info(gc, metaspace)("Metaspace: "
                           SIZE_FORMAT "M used, " SIZE_FORMAT "M capacity, "
-                          SIZE_FORMAT "M committed, " SIZE_FORMAT "M reserved",
+                          SIZE_FORMAT "M committed, " SIZE_FORMAT "M reserved, "
+                          SIZE_FORMAT "M released",
                           MetaspaceUtils::used_bytes() / M,
                           MetaspaceUtils::capacity_bytes() / M,
                           MetaspaceUtils::committed_bytes() / M,
-                          MetaspaceUtils::reserved_bytes() / M);
+                          MetaspaceUtils::reserved_bytes() / M,
+                          _released / M);
+
+  // Reset, only report memory released in this cycle
+  _released = 0;
 }
 
 //
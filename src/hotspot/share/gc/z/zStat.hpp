@@ -222,6 +222,9 @@ public:
 };
 
 class ZStatPhaseCycle : public ZStatPhase {
+private:
+  const ZStatSampler _cpu_sampler;
+
 public:
   ZStatPhaseCycle(const char* name);
 
@@ -233,6 +236,8 @@ class ZStatPhasePause : public ZStatPhase {
 private:
   static Tickspan _max; // Max pause time
 
+  const ZStatSampler _cpu_sampler;
+
 public:
   ZStatPhasePause(const char* name);
 
@@ -243,6 +248,9 @@ public:
 };
 
 class ZStatPhaseConcurrent : public ZStatPhase {
+private:
+  const ZStatSampler _cpu_sampler;
+
 public:
   ZStatPhaseConcurrent(const char* name);
 
@@ -386,6 +394,31 @@ public:
   static double time_since_last();
 };
 
+//
+// Stat CPU time
+//
+class ZStatCPUTime : public AllStatic {
+private:
+  static jlong     _phase_start;
+  static jlong     _cycle;
+  static NumberSeq _overhead;
+
+  static jlong gc_threads(bool pause);
+
+public:
+  static void at_cycle_start();
+  static void at_cycle_end(double seconds_since_last);
+  static void at_phase_start(bool pause);
+  static jlong at_phase_end(bool pause);
+
+  static uint64_t to_ticks(jlong nanos);
+
+  static jlong cycle();
+  static const AbsSeq& overhead();
+
+  static void print(const Tickspan& duration);
+};
+
 //
 // Stat load
 //
@@ -422,13 +455,21 @@ class ZStatRelocation : public AllStatic {
 private:
   static ZRelocationSetSelectorStats _stats;
   static bool                        _success;
+  static volatile size_t             _buffer_installed;
+  static volatile size_t             _buffer_waste;
+  static volatile size_t             _buffer_contention;
 
   static void print(const char* name, const ZRelocationSetSelectorGroupStats& group);
+  static void print_age();
 
 public:
   static void set_at_select_relocation_set(const ZRelocationSetSelectorStats& stats);
   static void set_at_relocate_end(bool success);
 
+  static void inc_buffer_installed();
+  static void inc_buffer_waste(size_t size);
+  static void inc_buffer_contention();
+
   static void print();
 };
 
@@ -444,7 +485,12 @@ public:
 // Stat metaspace
 //
 class ZStatMetaspace : public AllStatic {
+private:
+  static size_t _released;
+
 public:
+  static void set_at_purge(size_t released);
+
   static void print();
 };
 
@@ -26,19 +26,26 @@
 
 #include "gc/z/zMarkStack.hpp"
 #include "gc/z/zGlobals.hpp"
+#include "gc/z/zRelocationBuffer.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/sizes.hpp"
 
+class ZMarkCache;
+
 class ZThreadLocalData {
 private:
   uintptr_t              _address_bad_mask;
   ZMarkThreadLocalStacks _stacks;
+  ZMarkCache*            _mark_cache;
+  ZRelocationBuffer      _relocation_buffer;
   oop*                   _invisible_root;
 
   ZThreadLocalData() :
       _address_bad_mask(0),
       _stacks(),
+      _mark_cache(NULL),
+      _relocation_buffer(),
       _invisible_root(NULL) {}
 
   static ZThreadLocalData* data(Thread* thread) {
@@ -62,6 +69,18 @@ public:
     return &data(thread)->_stacks;
   }
 
+  static ZMarkCache* mark_cache(Thread* thread) {
+    return data(thread)->_mark_cache;
+  }
+
+  static void set_mark_cache(Thread* thread, ZMarkCache* cache) {
+    data(thread)->_mark_cache = cache;
+  }
+
+  static ZRelocationBuffer* relocation_buffer(Thread* thread) {
+    return &data(thread)->_relocation_buffer;
+  }
+
   static void set_invisible_root(Thread* thread, oop* root) {
     assert(data(thread)->_invisible_root == NULL, "Already set");
     data(thread)->_invisible_root = root;
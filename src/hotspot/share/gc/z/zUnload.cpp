@@ -34,7 +34,9 @@
 #include "gc/z/zOopClosures.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zUnload.hpp"
+#include "memory/metaspace.hpp"
 #include "oops/access.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 
 static const ZStatSubPhase ZSubPhaseConcurrentClassesUnlink("Concurrent Classes Unlink");
 static const ZStatSubPhase ZSubPhaseConcurrentClassesPurge("Concurrent Classes Purge");
@@ -159,10 +161,21 @@ void ZUnload::purge() {
 
   ClassLoaderDataGraph::purge(/*at_safepoint*/false);
   CodeCache::purge_exception_caches();
+
+  // Release memory of free metaspace chunks
+  const size_t released = Metaspace::release_free_chunks();
+  ZStatMetaspace::set_at_purge(released);
 }
 
-void ZUnload::finish() {
-  // Resize and verify metaspace
+void ZUnload::resize() {
+  // Resize metaspace. This is done concurrently, while holding the
+  // MetaspaceExpand_lock to keep the committed metaspace from growing.
+  MutexLocker ml(MetaspaceExpand_lock, Mutex::_no_safepoint_check_flag);
   MetaspaceGC::compute_new_size();
+}
+
+void ZUnload::finish() {
+  // Verify metaspace. The metaspace counters are only
+  // guaranteed to be consistent at a safepoint.
   MetaspaceUtils::verify_metrics();
 }
@@ -36,6 +36,7 @@ public:
   void prepare();
   void unlink();
   void purge();
+  void resize();
   void finish();
 };
 
@@ -31,10 +31,15 @@
 #include "gc/z/zRootsIterator.hpp"
 #include "gc/z/zStackWatermark.hpp"
 #include "gc/z/zStat.hpp"
+#include "gc/z/zTask.hpp"
+#include "gc/z/zThread.inline.hpp"
 #include "gc/z/zVerify.hpp"
+#include "gc/z/zWorkers.inline.hpp"
+#include "logging/log.hpp"
 #include "memory/iterator.inline.hpp"
 #include "memory/resourceArea.inline.hpp"
 #include "oops/oop.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/stackWatermark.inline.hpp"
 #include "runtime/stackWatermarkSet.inline.hpp"
@@ -42,6 +47,9 @@
 
 #define BAD_OOP_ARG(o, p)   "Bad oop " PTR_FORMAT " found at " PTR_FORMAT, p2i(o), p2i(p)
 
+// Max number of bad oops reported per worker during object verification
+static const size_t ZVerifyFailuresReportMax = 10;
+
 static void z_verify_oop(oop* p) {
   const oop o = RawAccess<>::oop_load(p);
   if (o != NULL) {
@@ -51,15 +59,6 @@ static void z_verify_oop(oop* p) {
   }
 }
 
-static void z_verify_possibly_weak_oop(oop* p) {
-  const oop o = RawAccess<>::oop_load(p);
-  if (o != NULL) {
-    const uintptr_t addr = ZOop::to_address(o);
-    guarantee(ZAddress::is_good(addr) || ZAddress::is_finalizable_good(addr), BAD_OOP_ARG(o, p));
-    guarantee(oopDesc::is_oop(ZOop::from_address(ZAddress::good(addr))), BAD_OOP_ARG(o, p));
-  }
-}
-
 class ZVerifyRootClosure : public ZRootsIteratorClosure {
 private:
   const bool _verify_fixed;
@@ -180,22 +179,37 @@ void ZVerifyRootClosure::do_thread(Thread* thread) {
   verify_stack.verify_frames();
 }
 
-class ZVerifyOopClosure : public ClaimMetadataVisitingOopIterateClosure, public ZRootsIteratorClosure  {
+class ZVerifyOopClosure : public ClaimMetadataVisitingOopIterateClosure {
 private:
   const bool _verify_weaks;
+  size_t     _nfailures;
+
+  bool is_valid(oop o) const {
+    const uintptr_t addr = ZOop::to_address(o);
+    if (_verify_weaks) {
+      return (ZAddress::is_good(addr) || ZAddress::is_finalizable_good(addr)) &&
+             oopDesc::is_oop(ZOop::from_address(ZAddress::good(addr)));
+    } else {
+      // We should never encounter finalizable oops through strong
+      // paths. This assumes we have only visited strong objects.
+      return ZAddress::is_good(addr) &&
+             oopDesc::is_oop(ZOop::from_address(addr));
+    }
+  }
 
 public:
   ZVerifyOopClosure(bool verify_weaks) :
       ClaimMetadataVisitingOopIterateClosure(ClassLoaderData::_claim_other),
-      _verify_weaks(verify_weaks) {}
+      _verify_weaks(verify_weaks),
+      _nfailures(0) {}
 
   virtual void do_oop(oop* p) {
-    if (_verify_weaks) {
-      z_verify_possibly_weak_oop(p);
-    } else {
-      // We should never encounter finalizable oops through strong
-      // paths. This assumes we have only visited strong roots.
-      z_verify_oop(p);
+    const oop o = RawAccess<>::oop_load(p);
+    if (o != NULL && !is_valid(o)) {
+      // Report the first few failures, and count the rest
+      if (_nfailures++ < ZVerifyFailuresReportMax) {
+        log_error(gc, verify)("Worker %u: " BAD_OOP_ARG(o, p), ZThread::worker_id());
+      }
     }
   }
 
@@ -213,6 +227,39 @@ public:
     return false;
   }
 #endif
+
+  size_t nfailures() const {
+    return _nfailures;
+  }
+};
+
+class ZVerifyObjectsTask : public ZTask {
+private:
+  ParallelObjectIterator* const _iter;
+  const bool                    _verify_weaks;
+  volatile size_t               _nfailures;
+
+public:
+  ZVerifyObjectsTask(ParallelObjectIterator* iter, bool verify_weaks) :
+      ZTask("ZVerifyObjectsTask"),
+      _iter(iter),
+      _verify_weaks(verify_weaks),
+      _nfailures(0) {}
+
+  virtual void work() {
+    ZVerifyOopClosure cl(_verify_weaks);
+    ObjectToOopClosure object_cl(&cl);
+    _iter->object_iterate(&object_cl, ZThread::worker_id());
+
+    if (cl.nfailures() > 0) {
+      log_error(gc, verify)("Worker %u: Found " SIZE_FORMAT " bad oops", ZThread::worker_id(), cl.nfailures());
+      Atomic::add(&_nfailures, cl.nfailures());
+    }
+  }
+
+  size_t nfailures() const {
+    return Atomic::load(&_nfailures);
+  }
 };
 
 template <typename RootsIterator>
@@ -227,14 +274,6 @@ void ZVerify::roots(bool verify_fixed) {
   }
 }
 
-void ZVerify::roots_strong() {
-  roots<ZRootsIterator>(true /* verify_fixed */);
-}
-
-void ZVerify::roots_weak() {
-  roots<ZWeakRootsIterator>(true /* verify_fixed */);
-}
-
 void ZVerify::roots_concurrent_strong(bool verify_fixed) {
   roots<ZConcurrentRootsIteratorClaimNone>(verify_fixed);
 }
@@ -244,10 +283,8 @@ void ZVerify::roots_concurrent_weak() {
 }
 
 void ZVerify::roots(bool verify_concurrent_strong, bool verify_weaks) {
-  roots_strong();
   roots_concurrent_strong(verify_concurrent_strong);
   if (verify_weaks) {
-    roots_weak();
     roots_concurrent_weak();
   }
 }
@@ -258,9 +295,16 @@ void ZVerify::objects(bool verify_weaks) {
   assert(!ZResurrection::is_blocked(), "Invalid phase");
 
   if (ZVerifyObjects) {
-    ZVerifyOopClosure cl(verify_weaks);
-    ObjectToOopClosure object_cl(&cl);
-    ZHeap::heap()->object_iterate(&object_cl, verify_weaks);
+    ZHeap* const heap = ZHeap::heap();
+    ZWorkers* const workers = heap->workers();
+
+    // Walk the object graph from the roots in parallel
+    ParallelObjectIterator* const iter = heap->parallel_object_iterator(workers->nparallel(), verify_weaks);
+    ZVerifyObjectsTask task(iter, verify_weaks);
+    workers->run_parallel(&task);
+    delete iter;
+
+    guarantee(task.nfailures() == 0, "Object verification failed, found " SIZE_FORMAT " bad oops", task.nfailures());
   }
 }
 
@@ -33,8 +33,6 @@ class ZVerify : public AllStatic {
 private:
   template <typename RootsIterator> static void roots(bool verify_fixed);
 
-  static void roots_strong();
-  static void roots_weak();
   static void roots_concurrent_strong(bool verify_fixed);
   static void roots_concurrent_weak();
 
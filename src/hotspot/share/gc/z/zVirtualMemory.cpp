@@ -30,6 +30,7 @@
 #include "services/memTracker.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
+#include "utilities/ticks.hpp"
 
 ZVirtualMemoryManager::ZVirtualMemoryManager(size_t max_capacity) :
     _manager(),
@@ -153,6 +154,7 @@ bool ZVirtualMemoryManager::reserve(size_t max_capacity) {
   const size_t limit = MIN2(ZAddressOffsetMax, ZAddressSpaceLimit::heap_view());
   const size_t size = MIN2(max_capacity * ZVirtualToPhysicalRatio, limit);
 
+  const Ticks start = Ticks::now();
   size_t reserved = size;
   bool contiguous = true;
 
@@ -163,12 +165,15 @@ bool ZVirtualMemoryManager::reserve(size_t max_capacity) {
     contiguous = false;
   }
 
+  const Tickspan duration = Ticks::now() - start;
+
   log_info_p(gc, init)("Address Space Type: %s/%s/%s",
                        (contiguous ? "Contiguous" : "Discontiguous"),
                        (limit == ZAddressOffsetMax ? "Unrestricted" : "Restricted"),
                        (reserved == size ? "Complete" : "Degraded"));
   log_info_p(gc, init)("Address Space Size: " SIZE_FORMAT "M x " SIZE_FORMAT " = " SIZE_FORMAT "M",
                        reserved / M, ZHeapViews, (reserved * ZHeapViews) / M);
+  log_info_p(gc, init)("Address Space Reservation: %.3fms", TimeHelper::counter_to_millis(duration.value()));
 
   return reserved >= max_capacity;
 }
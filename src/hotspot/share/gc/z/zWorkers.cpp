@@ -30,6 +30,7 @@
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepoint.hpp"
+#include "utilities/ticks.hpp"
 
 class ZWorkersInitializeTask : public ZTask {
 private:
@@ -66,6 +67,7 @@ public:
 
 ZWorkers::ZWorkers() :
     _boost(false),
+    _started(false),
     _workers("ZWorker",
              nworkers(),
              true /* are_GC_task_threads */,
@@ -73,11 +75,30 @@ ZWorkers::ZWorkers() :
 
   log_info_p(gc, init)("Workers: %u parallel, %u concurrent", nparallel(), nconcurrent());
 
+  if (ZLazyWorkers) {
+    // Worker threads are started when first used
+    log_info_p(gc, init)("Workers Startup: Deferred");
+    return;
+  }
+
+  start();
+}
+
+void ZWorkers::start() {
+  assert(!_started, "Already started");
+  _started = true;
+
+  const Ticks start_time = Ticks::now();
+
   // Initialize worker threads
   _workers.initialize_workers();
   _workers.update_active_workers(nworkers());
   if (_workers.active_workers() != nworkers()) {
-    vm_exit_during_initialization("Failed to create ZWorkers");
+    if (ZLazyWorkers) {
+      fatal("Failed to create ZWorkers");
+    } else {
+      vm_exit_during_initialization("Failed to create ZWorkers");
+    }
   }
 
   // Execute task to register threads as workers. This also helps
@@ -85,6 +106,9 @@ ZWorkers::ZWorkers() :
   // to take on any warmup costs.
   ZWorkersInitializeTask task(nworkers());
   run(&task, nworkers());
+
+  const Tickspan duration = Ticks::now() - start_time;
+  log_info_p(gc, init)("Workers Startup: %.3fms", TimeHelper::counter_to_millis(duration.value()));
 }
 
 void ZWorkers::set_boost(bool boost) {
@@ -96,6 +120,11 @@ void ZWorkers::set_boost(bool boost) {
 }
 
 void ZWorkers::run(ZTask* task, uint nworkers) {
+  if (!_started) {
+    // Lazily start worker threads
+    start();
+  }
+
   log_debug(gc, task)("Executing Task: %s, Active Workers: %u", task->name(), nworkers);
   _workers.update_active_workers(nworkers);
   _workers.run_task(task->gang_task());
@@ -33,8 +33,10 @@ class ZTask;
 class ZWorkers {
 private:
   bool     _boost;
+  bool     _started;
   WorkGang _workers;
 
+  void start();
   void run(ZTask* task, uint nworkers);
 
 public:
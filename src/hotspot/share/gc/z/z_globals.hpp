@@ -55,6 +55,26 @@
           "Uncommit memory if it has been unused for the specified "        \
           "amount of time (in seconds)")                                    \
                                                                             \
+  product(size_t, ZHeapGranuleSize, 0, EXPERIMENTAL,                        \
+          "Heap granule size, which is also the small page size. "          \
+          "Zero means use the platform default")                            \
+                                                                            \
+  product(bool, ZLazyWorkers, false, EXPERIMENTAL,                          \
+          "Defer creation of GC worker threads until first used")          \
+                                                                            \
+  product(bool, ZRecordObjectSampleReferrers, false, EXPERIMENTAL,          \
+          "Record the referrers of JFR old object samples while marking, "  \
+          "and use them for reference chains instead of walking the heap")  \
+                                                                            \
+  product(bool, ZNMethodHotness, true, DIAGNOSTIC,                          \
+          "Use nmethod entry barriers to track nmethod hotness for the "    \
+          "code cache sweeper")                                             \
+                                                                            \
+  product(int, ZEventLogEntries, 256, DIAGNOSTIC,                           \
+          "Number of entries in the ZGC event log ring buffer, printed "    \
+          "in hs_err files and on out of memory (0 disables the log)")      \
+          range(0, 64 * K)                                                  \
+                                                                            \
   product(uint, ZStatisticsInterval, 10, DIAGNOSTIC,                        \
           "Time between statistics print outs (in seconds)")                \
           range(1, (uint)-1)                                                \
@@ -41,6 +41,7 @@
 #include "jfr/leakprofiler/sampling/objectSample.hpp"
 #include "jfr/leakprofiler/sampling/objectSampler.hpp"
 #include "jfr/leakprofiler/utilities/granularTimer.hpp"
+#include "jfr/leakprofiler/utilities/unifiedOopRef.inline.hpp"
 #include "logging/log.hpp"
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
@@ -78,6 +79,64 @@ static void log_edge_queue_summary(const EdgeQueue& edge_queue) {
   }
 }
 
+static bool has_valid_referrer(const ObjectSample* sample) {
+  const oop referrer = sample->referrer();
+  if (referrer == NULL) {
+    return false;
+  }
+  // The referrer was recorded by the GC during the last marking,
+  // make sure it still holds on to the sample object.
+  return referrer->obj_field(sample->referrer_offset()) == sample->object();
+}
+
+// Mark the referrers recorded by the GC during marking as leak candidates
+// as well, so that the search also finds their paths to the GC roots.
+static void mark_referrers(const ObjectSampler* sampler, ObjectSampleMarker& marker, bool emit_all) {
+  const jlong last_sweep = emit_all ? max_jlong : ObjectSampler::last_sweep();
+
+  for (const ObjectSample* sample = sampler->last(); sample != NULL; sample = sample->next()) {
+    if (sample->is_alive_and_older_than(last_sweep) && has_valid_referrer(sample)) {
+      const oop referrer = sample->referrer();
+      if (!referrer->mark().is_marked()) {
+        // Not a sample object, nor the referrer of another sample
+        marker.mark(referrer);
+      }
+    }
+  }
+}
+
+// The search can stop before reaching a sample object, either when
+// running out of time or when the sample is too deep for the depth-first
+// search. If the search did reach the referrer recorded by the GC, use the
+// referencing field as the starting edge of the sample's chain, and
+// complete it with the path from the referrer to its GC root.
+static void link_with_referrers(const ObjectSampler* sampler, EdgeStore* edge_store, bool emit_all) {
+  const jlong last_sweep = emit_all ? max_jlong : ObjectSampler::last_sweep();
+
+  for (const ObjectSample* sample = sampler->last(); sample != NULL; sample = sample->next()) {
+    if (!sample->is_alive_and_older_than(last_sweep) || !has_valid_referrer(sample)) {
+      continue;
+    }
+
+    if (!sample->object()->mark().is_marked()) {
+      // Already associated with a chain by the search
+      continue;
+    }
+
+    const oop referrer = sample->referrer();
+    if (referrer->mark().is_marked()) {
+      // Referrer not reached by the search either
+      continue;
+    }
+
+    // The mark word of a reached leak candidate points to its leak context edge
+    const Edge* const referrer_edge = (const Edge*)referrer->mark().to_pointer();
+    oop* const field = (oop*)(cast_from_oop<address>(referrer) + sample->referrer_offset());
+    const Edge leak(referrer_edge, UnifiedOopRef::encode_in_heap(field));
+    edge_store->put_chain(&leak, leak.distance_to_root() + 1);
+  }
+}
+
 void PathToGcRootsOperation::doit() {
   assert(SafepointSynchronize::is_at_safepoint(), "invariant");
   assert(_cutoff_ticks > 0, "invariant");
@@ -105,6 +164,9 @@ void PathToGcRootsOperation::doit() {
     return;
   }
 
+  // Also search for the referrers recorded during marking, if available
+  mark_referrers(_sampler, marker, _emit_all);
+
   // Necessary condition for attempting a root set iteration
   Universe::heap()->ensure_parsability(false);
 
@@ -124,6 +186,9 @@ void PathToGcRootsOperation::doit() {
   GranularTimer::stop();
   log_edge_queue_summary(edge_queue);
 
+  // Complete chains for samples not reached by the search through their referrers
+  link_with_referrers(_sampler, _edge_store, _emit_all);
+
   // Emit old objects including their reference chains as events
   EventEmitter emitter(GranularTimer::start_time(), GranularTimer::end_time());
   emitter.write_events(_sampler, _edge_store, _emit_all);
@@ -52,7 +52,35 @@ void ObjectSample::set_object(oop object) {
   _object = WeakHandle(ObjectSampler::oop_storage(), h);
 }
 
+const oop ObjectSample::referrer() const {
+  return _referrer.is_empty() ? (oop)NULL : _referrer.resolve();
+}
+
+const oop* ObjectSample::referrer_addr() const {
+  return _referrer.ptr_raw();
+}
+
+void ObjectSample::set_referrer(oop referrer, int offset) {
+  assert(referrer != NULL, "invariant");
+  if (_referrer.is_empty()) {
+    _referrer = WeakHandle(ObjectSampler::oop_storage(), referrer);
+  } else {
+    _referrer.replace(referrer);
+  }
+  _referrer_offset = offset;
+}
+
+void ObjectSample::clear_referrer() {
+  if (!_referrer.is_empty()) {
+    _referrer.replace(NULL);
+  }
+  _referrer_offset = 0;
+}
+
 void ObjectSample::release() {
   _object.release(ObjectSampler::oop_storage());
   _object = WeakHandle();
+  _referrer.release(ObjectSampler::oop_storage());
+  _referrer = WeakHandle();
+  _referrer_offset = 0;
 }
@@ -50,6 +50,7 @@ class ObjectSample : public JfrCHeapObj {
   JfrBlobHandle _thread;
   JfrBlobHandle _type_set;
   WeakHandle    _object;
+  WeakHandle    _referrer;
   Ticks _allocation_time;
   traceid _stack_trace_id;
   traceid _thread_id;
@@ -58,6 +59,7 @@ class ObjectSample : public JfrCHeapObj {
   size_t _allocated;
   size_t _heap_used_at_last_gc;
   unsigned int _stack_trace_hash;
+  int _referrer_offset;
 
   void release_references() {
     _stacktrace.~JfrBlobHandle();
@@ -73,6 +75,8 @@ class ObjectSample : public JfrCHeapObj {
                    _stacktrace(),
                    _thread(),
                    _type_set(),
+                   _object(),
+                   _referrer(),
                    _allocation_time(),
                    _stack_trace_id(0),
                    _thread_id(0),
@@ -80,7 +84,8 @@ class ObjectSample : public JfrCHeapObj {
                    _span(0),
                    _allocated(0),
                    _heap_used_at_last_gc(0),
-                   _stack_trace_hash(0) {}
+                   _stack_trace_hash(0),
+                   _referrer_offset(0) {}
 
   ObjectSample* next() const {
     return _next;
@@ -105,6 +110,16 @@ class ObjectSample : public JfrCHeapObj {
 
   const oop* object_addr() const;
 
+  // The object holding a reference to the sample object, as recorded
+  // by a GC while marking, and the offset of the referencing field.
+  const oop referrer() const;
+  const oop* referrer_addr() const;
+  int referrer_offset() const {
+    return _referrer_offset;
+  }
+  void set_referrer(oop referrer, int offset);
+  void clear_referrer();
+
   void release();
 
   int index() const {
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
+#include "logging/logConfiguration.hpp"
+#include "logging/logFileOutput.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.inline.hpp"
+#include "utilities/debug.hpp"
+
+AsyncLogWriter* AsyncLogWriter::_instance = NULL;
+
+class AsyncLogLocker : public StackObj {
+ private:
+  os::PlatformMonitor* const _lock;
+
+ public:
+  AsyncLogLocker(os::PlatformMonitor* lock) : _lock(lock) {
+    _lock->lock();
+  }
+
+  ~AsyncLogLocker() {
+    _lock->unlock();
+  }
+};
+
+AsyncLogMessage::AsyncLogMessage(LogFileOutput* output, const LogDecorations& decorations, const char* message)
+    : _output(output), _decorations(decorations), _message(os::strdup(message, mtLogging)) {}
+
+AsyncLogMessage::~AsyncLogMessage() {
+  os::free(_message);
+}
+
+AsyncLogWriter::AsyncLogWriter(size_t capacity)
+    : _lock(),
+      _io_sem(1),
+      _buffer(NEW_C_HEAP_ARRAY(AsyncLogMessage*, capacity, mtLogging)),
+      _capacity(capacity),
+      _head(0),
+      _count(0) {}
+
+AsyncLogWriter::~AsyncLogWriter() {
+  for (size_t i = 0; i < _count; i++) {
+    delete _buffer[(_head + i) % _capacity];
+  }
+  FREE_C_HEAP_ARRAY(AsyncLogMessage*, _buffer);
+}
+
+void AsyncLogWriter::initialize() {
+  if (AsyncLogBufferSize == 0) {
+    // Disabled
+    return;
+  }
+
+  assert(_instance == NULL, "Already initialized");
+  AsyncLogWriter* const writer = new AsyncLogWriter(AsyncLogBufferSize);
+  if (!os::create_thread(writer, os::os_thread)) {
+    // Fall back to synchronous logging
+    log_warning(logging)("Failed to create asynchronous log writer thread, logging synchronously");
+    return;
+  }
+
+  os::start_thread(writer);
+  _instance = writer;
+}
+
+bool AsyncLogWriter::drop_if_full_locked(LogFileOutput& output) {
+  if (_count < _capacity) {
+    return false;
+  }
+
+  // Buffer full, drop message
+  output.inc_dropped_messages();
+  return true;
+}
+
+void AsyncLogWriter::enqueue_locked(AsyncLogMessage* msg) {
+  if (drop_if_full_locked(*msg->output())) {
+    // Filled up while the message was copied
+    delete msg;
+    return;
+  }
+
+  _buffer[(_head + _count) % _capacity] = msg;
+  _count++;
+  _lock.notify();
+}
+
+void AsyncLogWriter::enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg) {
+  if (Atomic::load(&_count) >= _capacity) {
+    // Don't copy a message that would be dropped
+    AsyncLogLocker locker(&_lock);
+    if (drop_if_full_locked(output)) {
+      return;
+    }
+  }
+
+  // Copy message before taking the lock
+  AsyncLogMessage* const m = new AsyncLogMessage(&output, decorations, msg);
+
+  AsyncLogLocker locker(&_lock);
+  enqueue_locked(m);
+}
+
+void AsyncLogWriter::enqueue(LogFileOutput& output, LogMessageBuffer::Iterator msg_iterator) {
+  // Enqueue all lines under the lock, to keep them together
+  AsyncLogLocker locker(&_lock);
+  for (; !msg_iterator.is_at_end(); msg_iterator++) {
+    if (drop_if_full_locked(output)) {
+      continue;
+    }
+    enqueue_locked(new AsyncLogMessage(&output, msg_iterator.decorations(), msg_iterator.message()));
+  }
+}
+
+AsyncLogMessage* AsyncLogWriter::dequeue(size_t* dropped) {
+  AsyncLogLocker locker(&_lock);
+  if (_count == 0) {
+    return NULL;
+  }
+
+  AsyncLogMessage* const msg = _buffer[_head];
+  _head = (_head + 1) % _capacity;
+  _count--;
+
+  *dropped = msg->output()->clear_dropped_messages();
+  return msg;
+}
+
+static void write_dropped_report(LogFileOutput* output, const LogDecorations& decorations, size_t dropped) {
+  char report[128];
+  jio_snprintf(report, sizeof(report), "[" SIZE_FORMAT " messages dropped due to full async log buffer]", dropped);
+  output->write_blocking(decorations, report);
+}
+
+void AsyncLogWriter::write() {
+  size_t dropped = 0;
+  for (AsyncLogMessage* msg; (msg = dequeue(&dropped)) != NULL;) {
+    LogFileOutput* const output = msg->output();
+
+    if (dropped > 0) {
+      write_dropped_report(output, msg->decorations(), dropped);
+    }
+
+    output->write_blocking(msg->decorations(), msg->message());
+    delete msg;
+  }
+}
+
+void AsyncLogWriter::write_dropped(LogFileOutput* output) {
+  size_t dropped;
+  {
+    AsyncLogLocker locker(&_lock);
+    dropped = output->clear_dropped_messages();
+  }
+
+  if (dropped > 0) {
+    // No message follows to carry the report, so decorate it on its own
+    const LogDecorations decorations(LogLevel::Warning, LogTagSetMapping<LOG_TAGS(logging)>::tagset(), output->decorators());
+    write_dropped_report(output, decorations, dropped);
+  }
+}
+
+void AsyncLogWriter::run() {
+  for (;;) {
+    {
+      AsyncLogLocker locker(&_lock);
+      while (_count == 0) {
+        _lock.wait(0 /* forever */);
+      }
+    }
+
+    _io_sem.wait();
+    write();
+    _io_sem.signal();
+  }
+}
+
+void AsyncLogWriter::flush() {
+  AsyncLogWriter* const writer = _instance;
+  if (writer == NULL) {
+    return;
+  }
+
+  // Write all buffered messages. Serialized with the writer thread, so
+  // that all messages enqueued before the call have been written when
+  // this returns.
+  writer->_io_sem.wait();
+  writer->write();
+
+  // Report messages dropped after the last message written to each file
+  // output. The output may be about to be deleted, or the VM to exit.
+  for (size_t i = 2; i < LogConfiguration::_n_outputs; i++) {
+    // All outputs after stdout and stderr (idx 0 and 1) are file outputs
+    writer->write_dropped(static_cast<LogFileOutput*>(LogConfiguration::_outputs[i]));
+  }
+  writer->_io_sem.signal();
+}
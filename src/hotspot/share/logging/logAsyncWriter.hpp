@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#ifndef SHARE_LOGGING_LOGASYNCWRITER_HPP
+#define SHARE_LOGGING_LOGASYNCWRITER_HPP
+
+#include "logging/logDecorations.hpp"
+#include "logging/logMessageBuffer.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/os.hpp"
+#include "runtime/semaphore.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class LogFileOutput;
+
+// A log message, with its decorations, waiting to be written to a file output.
+class AsyncLogMessage : public CHeapObj<mtLogging> {
+ private:
+  LogFileOutput* const _output;
+  const LogDecorations _decorations;
+  char* const          _message;
+
+ public:
+  AsyncLogMessage(LogFileOutput* output, const LogDecorations& decorations, const char* message);
+  ~AsyncLogMessage();
+
+  LogFileOutput* output() const {
+    return _output;
+  }
+
+  const LogDecorations& decorations() const {
+    return _decorations;
+  }
+
+  const char* message() const {
+    return _message;
+  }
+};
+
+// Writes log file outputs asynchronously from a dedicated thread. Logging
+// threads only copy messages into a bounded buffer, and never block on I/O.
+// When the buffer is full, messages are dropped, without being copied, and
+// accounted on the output they were logged to. The number of dropped messages
+// is then reported on that output, in front of the next message written to
+// it, or when the buffer is flushed.
+class AsyncLogWriter : public NonJavaThread {
+  friend class AsyncLogWriterTest;
+
+ private:
+  static AsyncLogWriter* _instance;
+
+  os::PlatformMonitor     _lock;
+  Semaphore               _io_sem;
+  AsyncLogMessage** const _buffer;
+  const size_t            _capacity;
+  size_t                  _head;
+  size_t                  _count;
+
+  AsyncLogWriter(size_t capacity);
+  ~AsyncLogWriter();
+
+  bool drop_if_full_locked(LogFileOutput& output);
+  void enqueue_locked(AsyncLogMessage* msg);
+  AsyncLogMessage* dequeue(size_t* dropped);
+  void write();
+  void write_dropped(LogFileOutput* output);
+
+  virtual void run();
+
+ public:
+  static void initialize();
+  static void flush();
+
+  static AsyncLogWriter* instance() {
+    return _instance;
+  }
+
+  void enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg);
+  void enqueue(LogFileOutput& output, LogMessageBuffer::Iterator msg_iterator);
+
+  virtual char* name() const {
+    return (char*)"AsyncLog Thread";
+  }
+
+  virtual const char* type_name() const {
+    return "AsyncLogWriter";
+  }
+};
+
+#endif // SHARE_LOGGING_LOGASYNCWRITER_HPP
@@ -37,6 +37,7 @@ class LogSelectionList;
 // kept implicitly in the LogTagSets and their LogOutputLists. During configuration the tagsets
 // are iterated over and updated accordingly.
 class LogConfiguration : public AllStatic {
+ friend class AsyncLogWriter;
  friend class VMError;
  friend class LogTestFixture;
  public:
@@ -37,6 +37,16 @@ LogDecorations::LogDecorations(LogLevelType level, const LogTagSet &tagset, cons
   create_decorations(decorators);
 }
 
+LogDecorations::LogDecorations(const LogDecorations& other)
+    : _level(other._level), _tagset(other._tagset) {
+  // The decoration offsets point into the decorations buffer, rebase them
+  memcpy(_decorations_buffer, other._decorations_buffer, DecorationsBufferSize);
+  for (size_t i = 0; i < LogDecorators::Count; i++) {
+    const char* const offset = other._decoration_offset[i];
+    _decoration_offset[i] = (offset == NULL) ? NULL : _decorations_buffer + (offset - other._decorations_buffer);
+  }
+}
+
 const char* LogDecorations::host_name() {
   const char* host_name = Atomic::load_acquire(&_host_name);
   if (host_name == NULL) {
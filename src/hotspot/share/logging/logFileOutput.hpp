@@ -63,6 +63,10 @@ class LogFileOutput : public LogFileStreamOutput {
   // Semaphore used for synchronizing file rotations and writes
   Semaphore _rotation_semaphore;
 
+  // Number of messages dropped by asynchronous logging, protected by the
+  // asynchronous log writer lock
+  size_t  _dropped_messages;
+
   void archive();
   void rotate();
   bool parse_options(const char* options, outputStream* errstream);
@@ -85,6 +89,7 @@ class LogFileOutput : public LogFileStreamOutput {
   virtual bool initialize(const char* options, outputStream* errstream);
   virtual int write(const LogDecorations& decorations, const char* msg);
   virtual int write(LogMessageBuffer::Iterator msg_iterator);
+  int write_blocking(const LogDecorations& decorations, const char* msg);
   virtual void force_rotate();
   virtual void describe(outputStream* out);
 
@@ -95,6 +100,16 @@ class LogFileOutput : public LogFileStreamOutput {
   const char* cur_log_file_name();
   static const char* const Prefix;
   static void set_file_name_parameters(jlong start_time);
+
+  void inc_dropped_messages() {
+    _dropped_messages++;
+  }
+
+  size_t clear_dropped_messages() {
+    const size_t dropped = _dropped_messages;
+    _dropped_messages = 0;
+    return dropped;
+  }
 };
 
 #endif // SHARE_LOGGING_LOGFILEOUTPUT_HPP
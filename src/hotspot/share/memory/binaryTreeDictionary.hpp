@@ -41,6 +41,7 @@ class Mutex;
 
 template <class Chunk_t, class FreeList_t> class TreeChunk;
 template <class Chunk_t, class FreeList_t> class BinaryTreeDictionary;
+template <class Chunk_t, class FreeList_t> class TreeCensusClosure;
 template <class Chunk_t, class FreeList_t> class AscendTreeCensusClosure;
 template <class Chunk_t, class FreeList_t> class DescendTreeCensusClosure;
 template <class Chunk_t, class FreeList_t> class DescendTreeSearchClosure;
@@ -294,6 +295,9 @@ class BinaryTreeDictionary: public CHeapObj<mtGC> {
 
   void       print_free_lists(outputStream* st) const;
 
+  // Apply the closure to all free lists in the tree.
+  void       free_lists_do(TreeCensusClosure<Chunk_t, FreeList_t>* cl) const;
+
   // For debugging.  Returns the sum of the _returned_bytes for
   // all lists in the tree.
   size_t     sum_dict_returned_bytes()     PRODUCT_RETURN0;
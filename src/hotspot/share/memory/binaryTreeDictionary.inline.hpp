@@ -929,6 +929,11 @@ void BinaryTreeDictionary<Chunk_t, FreeList_t>::print_free_lists(outputStream* s
   pflc.do_tree(root());
 }
 
+template <class Chunk_t, class FreeList_t>
+void BinaryTreeDictionary<Chunk_t, FreeList_t>::free_lists_do(TreeCensusClosure<Chunk_t, FreeList_t>* cl) const {
+  cl->do_tree(root());
+}
+
 // Verify the following tree invariants:
 // . _root has no parent
 // . parent and child point to each other
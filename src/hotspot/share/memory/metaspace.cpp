@@ -44,6 +44,8 @@
 #include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/init.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/safepoint.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/debug.hpp"
@@ -237,6 +239,11 @@ size_t MetaspaceGC::allowed_expansion() {
 }
 
 void MetaspaceGC::compute_new_size() {
+  // Normally called at a safepoint. A concurrent caller must hold the
+  // MetaspaceExpand_lock, so that the committed memory can't grow and
+  // the HWM is never shrunk below it.
+  assert(SafepointSynchronize::is_at_safepoint() || MetaspaceExpand_lock->owned_by_self(),
+         "Should be at safepoint or hold MetaspaceExpand_lock");
   assert(_shrink_factor <= 100, "invalid shrink factor");
   uint current_shrink_factor = _shrink_factor;
   _shrink_factor = 0;
@@ -278,16 +285,21 @@ void MetaspaceGC::compute_new_size() {
     if (expand_bytes >= MinMetaspaceExpansion) {
       size_t new_capacity_until_GC = 0;
       bool succeeded = MetaspaceGC::inc_capacity_until_GC(expand_bytes, &new_capacity_until_GC);
-      assert(succeeded, "Should always succesfully increment HWM when at safepoint");
-
-      Metaspace::tracer()->report_gc_threshold(capacity_until_GC,
-                                               new_capacity_until_GC,
-                                               MetaspaceGCThresholdUpdater::ComputeNewSize);
-      log_trace(gc, metaspace)("    expanding:  minimum_desired_capacity: %6.1fKB  expand_bytes: %6.1fKB  MinMetaspaceExpansion: %6.1fKB  new metaspace HWM:  %6.1fKB",
-                               minimum_desired_capacity / (double) K,
-                               expand_bytes / (double) K,
-                               MinMetaspaceExpansion / (double) K,
-                               new_capacity_until_GC / (double) K);
+      // When called concurrently, an allocating thread can increment the
+      // HWM first. The HWM has then already grown, so skip the expansion.
+      assert(succeeded || !SafepointSynchronize::is_at_safepoint(),
+             "Should always succesfully increment HWM when at safepoint");
+
+      if (succeeded) {
+        Metaspace::tracer()->report_gc_threshold(capacity_until_GC,
+                                                 new_capacity_until_GC,
+                                                 MetaspaceGCThresholdUpdater::ComputeNewSize);
+        log_trace(gc, metaspace)("    expanding:  minimum_desired_capacity: %6.1fKB  expand_bytes: %6.1fKB  MinMetaspaceExpansion: %6.1fKB  new metaspace HWM:  %6.1fKB",
+                                 minimum_desired_capacity / (double) K,
+                                 expand_bytes / (double) K,
+                                 MinMetaspaceExpansion / (double) K,
+                                 new_capacity_until_GC / (double) K);
+      }
     }
     return;
   }
@@ -1387,6 +1399,16 @@ void Metaspace::purge() {
   }
 }
 
+size_t Metaspace::release_free_chunks() {
+  MutexLocker cl(MetaspaceExpand_lock,
+                 Mutex::_no_safepoint_check_flag);
+  size_t released = get_chunk_manager(NonClassType)->release_free_chunks();
+  if (using_class_space()) {
+    released += get_chunk_manager(ClassType)->release_free_chunks();
+  }
+  return released;
+}
+
 bool Metaspace::contains(const void* ptr) {
   if (MetaspaceShared::is_in_shared_metaspace(ptr)) {
     return true;
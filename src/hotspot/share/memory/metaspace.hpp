@@ -218,6 +218,9 @@ class Metaspace : public AllStatic {
   static void purge(MetadataType mdtype);
   static void purge();
 
+  // Release memory of free chunks to the OS, returns number of bytes released
+  static size_t release_free_chunks();
+
   static void report_metadata_oome(ClassLoaderData* loader_data, size_t word_size,
                                    MetaspaceObj::Type type, MetadataType mdtype, TRAPS);
 
@@ -35,6 +35,8 @@
 #include "memory/metaspace/occupancyMap.hpp"
 #include "memory/metaspace/virtualSpaceNode.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
@@ -546,6 +548,9 @@ void ChunkManager::return_single_chunk(Metachunk* chunk) {
   assert(chunk->is_tagged_free() == false, "Chunk should be in use.");
   index_bounds_check(index);
 
+  // The chunk payload is in use again, and has to be released anew.
+  chunk->set_is_released(false);
+
   // Note: mangle *before* returning the chunk to the freelist or dictionary. It does not
   // matter for the freelist (non-humongous chunks), but the humongous chunk dictionary
   // keeps tree node pointers in the chunk payload area which mangle will overwrite.
@@ -629,6 +634,75 @@ void ChunkManager::return_chunk_list(Metachunk* chunks) {
   }
 }
 
+size_t ChunkManager::release_chunk(Metachunk* chunk) {
+  if (chunk->is_released()) {
+    // Already released
+    return 0;
+  }
+
+  // Keep at least one page after the chunk start, which holds the chunk
+  // header and, for humongous chunks, the dictionary tree node.
+  const size_t page_size = os::vm_page_size();
+  char* const start = align_up((char*)chunk->bottom() + page_size, page_size);
+  char* const end = align_down((char*)(chunk->bottom() + chunk->word_size()), page_size);
+  if (start >= end) {
+    // Nothing to release
+    return 0;
+  }
+
+  const size_t size = pointer_delta(end, start, sizeof(char));
+  os::free_memory(start, size, page_size);
+  chunk->set_is_released(true);
+
+  return size;
+}
+
+class ReleaseHumongousChunksClosure : public AscendTreeCensusClosure<Metachunk, FreeList<Metachunk> > {
+ private:
+  size_t _released;
+
+ protected:
+  void do_list(FreeList<Metachunk>* fl) {
+    for (Metachunk* chunk = fl->head(); chunk != NULL; chunk = chunk->next()) {
+      _released += ChunkManager::release_chunk(chunk);
+    }
+  }
+
+ public:
+  ReleaseHumongousChunksClosure() : _released(0) {}
+
+  size_t released() const { return _released; }
+};
+
+size_t ChunkManager::release_free_chunks() {
+  assert_lock_strong(MetaspaceExpand_lock);
+
+  if (UseLargePagesInMetaspace) {
+    // Large pages can not be released
+    return 0;
+  }
+
+  size_t released = 0;
+
+  // Non-humongous chunks. Only medium chunks are larger than a few pages.
+  ChunkList* const list = free_chunks(MediumIndex);
+  for (Metachunk* chunk = list->head(); chunk != NULL; chunk = chunk->next()) {
+    released += release_chunk(chunk);
+  }
+
+  // Humongous chunks
+  ReleaseHumongousChunksClosure cl;
+  _humongous_dictionary.free_lists_do(&cl);
+  released += cl.released();
+
+  if (released > 0) {
+    log_debug(gc, metaspace, freelist)("released " SIZE_FORMAT "K of free %s chunk memory.",
+                                       released / K, _is_class ? "class space" : "metaspace");
+  }
+
+  return released;
+}
+
 void ChunkManager::collect_statistics(ChunkManagerStatistics* out) const {
   MutexLocker cl(MetaspaceExpand_lock, Mutex::_no_safepoint_check_flag);
   for (ChunkIndex i = ZeroIndex; i < NumberOfInUseLists; i = next_chunk_index(i)) {
@@ -37,12 +37,15 @@ class ChunkManagerTestAccessor;
 
 namespace metaspace {
 
+class ReleaseHumongousChunksClosure;
+
 typedef class FreeList<Metachunk> ChunkList;
 typedef BinaryTreeDictionary<Metachunk, FreeList<Metachunk> > ChunkTreeDictionary;
 
 // Manages the global free lists of chunks.
 class ChunkManager : public CHeapObj<mtInternal> {
   friend class ::ChunkManagerTestAccessor;
+  friend class ReleaseHumongousChunksClosure;
 
   // Free list of chunks of different sizes.
   //   SpecializedChunk
@@ -96,6 +99,11 @@ class ChunkManager : public CHeapObj<mtInternal> {
   // Note that this chunk is supposed to be removed from the freelist right away.
   Metachunk* split_chunk(size_t target_chunk_word_size, Metachunk* chunk);
 
+  // Helper for releasing free memory: releases the payload pages of a
+  // free chunk to the OS, keeping the page(s) holding the chunk header
+  // and any free list data. Returns number of bytes released.
+  static size_t release_chunk(Metachunk* chunk);
+
  public:
 
   ChunkManager(bool is_class);
@@ -136,6 +144,11 @@ class ChunkManager : public CHeapObj<mtInternal> {
   // Number of chunks in the free chunks list
   size_t free_chunks_count() const { return _free_chunks_count; }
 
+  // Release the payload memory of all free chunks to the OS. The memory stays
+  // committed, and is transparently faulted back in when a chunk is reused.
+  // Returns number of bytes released.
+  size_t release_free_chunks();
+
   // Remove from a list by size.  Selects list based on size of chunk.
   Metachunk* free_chunks_get(size_t chunk_word_size);
 
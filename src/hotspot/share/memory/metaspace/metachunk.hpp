@@ -98,6 +98,8 @@ class Metachunk : public Metabase<Metachunk> {
   const bool _is_class;
   // Whether the chunk is free (in freelist) or in use by some class loader.
   bool _is_tagged_free;
+  // Whether the payload of a free chunk has been released to the OS.
+  bool _is_released;
 
   ChunkOrigin _origin;
   int _use_count;
@@ -139,6 +141,9 @@ class Metachunk : public Metabase<Metachunk> {
   bool is_tagged_free() { return _is_tagged_free; }
   void set_is_tagged_free(bool v) { _is_tagged_free = v; }
 
+  bool is_released() const { return _is_released; }
+  void set_is_released(bool v) { _is_released = v; }
+
   bool contains(const void* ptr) { return bottom() <= ptr && ptr < _top; }
 
   void print_on(outputStream* st) const;
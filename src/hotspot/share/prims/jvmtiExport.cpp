@@ -680,16 +680,23 @@ void JvmtiExport::post_vm_start() {
 }
 
 static OopStorage* _jvmti_oop_storage = NULL;
+static OopStorage* _weak_tag_storage = NULL;
 
 OopStorage* JvmtiExport::jvmti_oop_storage() {
   assert(_jvmti_oop_storage != NULL, "not yet initialized");
   return _jvmti_oop_storage;
 }
 
+OopStorage* JvmtiExport::weak_tag_storage() {
+  assert(_weak_tag_storage != NULL, "not yet initialized");
+  return _weak_tag_storage;
+}
+
 void JvmtiExport::initialize_oop_storage() {
   // OopStorage needs to be created early in startup and unconditionally
   // because of OopStorageSet static array indices.
   _jvmti_oop_storage = OopStorageSet::create_strong("JVMTI OopStorage");
+  _weak_tag_storage = OopStorageSet::create_weak("JVMTI Tag Weak OopStorage");
 }
 
 void JvmtiExport::post_vm_initialized() {
@@ -1478,16 +1485,27 @@ void JvmtiExport::post_thread_end(JavaThread *thread) {
   }
 }
 
-void JvmtiExport::post_object_free(JvmtiEnv* env, jlong tag) {
-  assert(SafepointSynchronize::is_at_safepoint(), "must be executed at safepoint");
-  assert(env->is_enabled(JVMTI_EVENT_OBJECT_FREE), "checking");
+void JvmtiExport::post_object_free(JvmtiEnv* env, GrowableArray<jlong>* objects) {
+  assert(objects != NULL, "Nothing to post");
+
+  JavaThread* thread = JavaThread::current();
+  if (!env->is_enabled(JVMTI_EVENT_OBJECT_FREE)) {
+    return; // the event type has been disabled since the objects died
+  }
+
+  EVT_TRIG_TRACE(JVMTI_EVENT_OBJECT_FREE, ("[%s] Trg Object Free triggered",
+                                           JvmtiTrace::safe_get_thread_name(thread)));
 
-  EVT_TRIG_TRACE(JVMTI_EVENT_OBJECT_FREE, ("[?] Trg Object Free triggered" ));
-  EVT_TRACE(JVMTI_EVENT_OBJECT_FREE, ("[?] Evt Object Free sent"));
+  JvmtiThreadEventMark jem(thread);
+  JvmtiJavaThreadEventTransition jet(thread);
+  EVT_TRACE(JVMTI_EVENT_OBJECT_FREE, ("[%s] Evt Object Free sent",
+                                      JvmtiTrace::safe_get_thread_name(thread)));
 
   jvmtiEventObjectFree callback = env->callbacks()->ObjectFree;
   if (callback != NULL) {
-    (*callback)(env->jvmti_external(), tag);
+    for (int index = 0; index < objects->length(); index++) {
+      (*callback)(env->jvmti_external(), objects->at(index));
+    }
   }
 }
 
@@ -2617,7 +2635,10 @@ void JvmtiExport::clear_detected_exception(JavaThread* thread) {
 }
 
 void JvmtiExport::weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f) {
-  JvmtiTagMap::weak_oops_do(is_alive, f);
+  // The tagged objects themselves live in the weak tag OopStorage and
+  // are processed with the other weak OopStorages. This is only a
+  // notification that objects may have moved or died.
+  JvmtiTagMap::gc_notification();
 }
 
 // Onload raw monitor transition.
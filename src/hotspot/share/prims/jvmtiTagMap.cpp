@@ -41,11 +41,13 @@
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.inline.hpp"
+#include "oops/weakHandle.inline.hpp"
 #include "prims/jvmtiEventController.hpp"
 #include "prims/jvmtiEventController.inline.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "prims/jvmtiImpl.hpp"
 #include "prims/jvmtiTagMap.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/biasedLocking.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
@@ -54,6 +56,7 @@
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/reflectionUtils.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vframe.hpp"
@@ -66,20 +69,25 @@
 
 // JvmtiTagHashmapEntry
 //
-// Each entry encapsulates a reference to the tagged object
+// Each entry encapsulates a weak reference to the tagged object
 // and the tag value. In addition an entry includes a next pointer which
 // is used to chain entries together.
+//
+// The reference lives in the weak tag OopStorage, so the GC clears and
+// updates it together with the other weak OopStorages, possibly
+// concurrently. The tag map is told when that has happened and then
+// removes dead entries and rehashes lazily, see check_hashmap().
 
 class JvmtiTagHashmapEntry : public CHeapObj<mtInternal> {
  private:
   friend class JvmtiTagMap;
 
-  oop _object;                          // tagged object
+  WeakHandle _object;                   // tagged object
   jlong _tag;                           // the tag
   JvmtiTagHashmapEntry* _next;          // next on the list
 
   inline void init(oop object, jlong tag) {
-    _object = object;
+    _object = WeakHandle(JvmtiExport::weak_tag_storage(), object);
     _tag = tag;
     _next = NULL;
   }
@@ -87,20 +95,20 @@ class JvmtiTagHashmapEntry : public CHeapObj<mtInternal> {
   // constructor
   JvmtiTagHashmapEntry(oop object, jlong tag) { init(object, tag); }
 
+  // release the weak reference, the entry can then be reused
+  inline void release_object() {
+    _object.release(JvmtiExport::weak_tag_storage());
+    _object = WeakHandle();
+  }
+
  public:
 
   // accessor methods
-  inline oop* object_addr() { return &_object; }
-  inline oop object()       { return NativeAccess<ON_PHANTOM_OOP_REF>::oop_load(object_addr()); }
+  inline oop object()       { return _object.resolve(); }
   // Peek at the object without keeping it alive. The returned object must be
   // kept alive using a normal access if it leaks out of a thread transition from VM.
-  inline oop object_peek()  {
-    return NativeAccess<ON_PHANTOM_OOP_REF | AS_NO_KEEPALIVE>::oop_load(object_addr());
-  }
-
-  inline oop object_raw() {
-    return RawAccess<>::oop_load(object_addr());
-  }
+  // Returns NULL if the object has died.
+  inline oop object_peek()  { return _object.peek(); }
 
   inline jlong tag() const  { return _tag; }
 
@@ -228,7 +236,7 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
       while (entry != NULL) {
         JvmtiTagHashmapEntry* next = entry->next();
         oop key = entry->object_peek();
-        assert(key != NULL, "jni weak reference cleared!!");
+        assert(key != NULL, "weak reference cleared, tag map not checked");
         unsigned int h = hash(key, new_size);
         JvmtiTagHashmapEntry* anchor = new_table[h];
         if (anchor == NULL) {
@@ -375,6 +383,10 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
 
   // iterate over all entries in the hashmap
   void entry_iterate(JvmtiTagHashmapEntryClosure* closure);
+
+  // remove entries for dead objects and optionally move the remaining
+  // entries to the position for their current address
+  void unlink_and_rehash(JvmtiTagMap* tag_map, bool rehash, GrowableArray<jlong>* objects);
 };
 
 // possible hashmap sizes - odd primes that roughly double in size.
@@ -416,9 +428,9 @@ void JvmtiTagHashmap::print_memory_usage() {
   int hashmap_usage = (size()*sizeof(JvmtiTagHashmapEntry*) +
     entry_count()*sizeof(JvmtiTagHashmapEntry))/K;
 
-  int weak_globals_usage = (int)(JNIHandles::weak_global_handle_memory_usage()/K);
-  tty->print_cr(", %d entries (%d KB) <JNI weak globals: %d KB>]",
-    entry_count(), hashmap_usage, weak_globals_usage);
+  int weak_handles_usage = (int)(JvmtiExport::weak_tag_storage()->total_memory_usage()/K);
+  tty->print_cr(", %d entries (%d KB) <weak tag handles: %d KB>]",
+    entry_count(), hashmap_usage, weak_handles_usage);
 }
 
 // compute threshold for the next trace message
@@ -440,7 +452,10 @@ JvmtiTagMap::JvmtiTagMap(JvmtiEnv* env) :
   _env(env),
   _lock(Mutex::nonleaf+2, "JvmtiTagMap._lock", false),
   _free_entries(NULL),
-  _free_entries_count(0)
+  _free_entries_count(0),
+  _dead_objects(new (ResourceObj::C_HEAP, mtServiceability) GrowableArray<jlong>(0, mtServiceability)),
+  _needs_rehashing(false),
+  _needs_cleaning(false)
 {
   assert(JvmtiThreadState_lock->is_locked(), "sanity check");
   assert(((JvmtiEnvBase *)env)->tag_map() == NULL, "tag map already exists for environment");
@@ -464,6 +479,7 @@ JvmtiTagMap::~JvmtiTagMap() {
     JvmtiTagHashmapEntry* entry = table[j];
     while (entry != NULL) {
       JvmtiTagHashmapEntry* next = entry->next();
+      entry->release_object();
       delete entry;
       entry = next;
     }
@@ -481,6 +497,9 @@ JvmtiTagMap::~JvmtiTagMap() {
     entry = next;
   }
   _free_entries = NULL;
+
+  delete _dead_objects;
+  _dead_objects = NULL;
 }
 
 // create a hashmap entry
@@ -509,6 +528,7 @@ JvmtiTagHashmapEntry* JvmtiTagMap::create_entry(oop ref, jlong tag) {
 // destroy an entry by returning it to the free list
 void JvmtiTagMap::destroy_entry(JvmtiTagHashmapEntry* entry) {
   assert(SafepointSynchronize::is_at_safepoint() || is_locked(), "checking");
+  entry->release_object();
   // limit the size of the free list
   if (_free_entries_count >= max_free_entries) {
     delete entry;
@@ -733,6 +753,9 @@ class TwoOopCallbackWrapper : public CallbackWrapper {
 void JvmtiTagMap::set_tag(jobject object, jlong tag) {
   MutexLocker ml(lock());
 
+  // Check if we have to process for concurrent GC.
+  check_hashmap();
+
   // resolve the object
   oop o = JNIHandles::resolve_non_null(object);
 
@@ -765,6 +788,9 @@ void JvmtiTagMap::set_tag(jobject object, jlong tag) {
 jlong JvmtiTagMap::get_tag(jobject object) {
   MutexLocker ml(lock());
 
+  // Check if we have to process for concurrent GC.
+  check_hashmap();
+
   // resolve the object
   oop o = JNIHandles::resolve_non_null(object);
 
@@ -1269,6 +1295,9 @@ class VM_HeapIterateOperation: public VM_Operation {
     // allows class files maps to be cached during iteration
     ClassFieldMapCacheMark cm;
 
+    // remove dead entries and rehash the tag maps before walking
+    JvmtiTagMap::check_hashmaps_for_heapwalk();
+
     // make sure that heap is parsable (fills TLABs with filler objects)
     Universe::heap()->ensure_parsability(false);  // no need to retire TLABs
 
@@ -1605,6 +1634,8 @@ jvmtiError JvmtiTagMap::get_objects_with_tags(const jlong* tags,
   {
     // iterate over all tagged objects
     MutexLocker ml(lock());
+    // Check if we have to process for concurrent GC.
+    check_hashmap();
     entry_iterate(&collector);
   }
   return collector.result(count_ptr, object_result_ptr, tag_result_ptr);
@@ -3207,6 +3238,9 @@ void VM_HeapWalkOperation::doit() {
   ObjectMarkerController marker;
   ClassFieldMapCacheMark cm;
 
+  // remove dead entries and rehash the tag maps before walking
+  JvmtiTagMap::check_hashmaps_for_heapwalk();
+
   assert(visit_stack()->is_empty(), "visit stack must be empty");
 
   // the heap walk starts with an initial object or the heap roots
@@ -3286,10 +3320,21 @@ void JvmtiTagMap::follow_references(jint heap_filter,
 }
 
 
-void JvmtiTagMap::weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f) {
+// Set by the GC when tagged objects may have died, guarded by Service_lock.
+bool JvmtiTagMap::_has_object_free_events = false;
+
+void JvmtiTagMap::gc_notification() {
   // No locks during VM bring-up (0 threads) and no safepoints after main
   // thread creation and before VMThread creation (1 thread); initial GC
   // verification can happen in that window which gets to here.
+  assert(Threads::number_of_threads() <= 1 ||
+         SafepointSynchronize::is_at_safepoint(),
+         "must be executed at a safepoint");
+  set_needs_rehashing();
+  set_needs_cleaning();
+}
+
+void JvmtiTagMap::set_needs_rehashing() {
   assert(Threads::number_of_threads() <= 1 ||
          SafepointSynchronize::is_at_safepoint(),
          "must be executed at a safepoint");
@@ -3298,35 +3343,123 @@ void JvmtiTagMap::weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f) {
     for (JvmtiEnvBase* env = it.first(); env != NULL; env = it.next(env)) {
       JvmtiTagMap* tag_map = env->tag_map_acquire();
       if (tag_map != NULL && !tag_map->is_empty()) {
-        tag_map->do_weak_oops(is_alive, f);
+        Atomic::store(&tag_map->_needs_rehashing, true);
       }
     }
   }
 }
 
-void JvmtiTagMap::do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f) {
+void JvmtiTagMap::set_needs_cleaning() {
+  assert(Threads::number_of_threads() <= 1 ||
+         SafepointSynchronize::is_at_safepoint(),
+         "must be executed at a safepoint");
+  if (JvmtiEnv::environments_might_exist()) {
+    bool post_object_free = false;
+    JvmtiEnvIterator it;
+    for (JvmtiEnvBase* env = it.first(); env != NULL; env = it.next(env)) {
+      JvmtiTagMap* tag_map = env->tag_map_acquire();
+      if (tag_map != NULL && !tag_map->is_empty()) {
+        Atomic::store(&tag_map->_needs_cleaning, true);
+        post_object_free |= env->is_enabled(JVMTI_EVENT_OBJECT_FREE);
+      }
+    }
+
+    if (post_object_free) {
+      // Let the service thread remove the dead entries and post
+      // the ObjectFree events outside of the GC.
+      MonitorLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+      _has_object_free_events = true;
+      ml.notify_all();
+    }
+  }
+}
+
+bool JvmtiTagMap::has_object_free_events_and_reset() {
+  assert_lock_strong(Service_lock);
+  const bool result = _has_object_free_events;
+  _has_object_free_events = false;
+  return result;
+}
+
+void JvmtiTagMap::flush_all_object_free_events() {
+  assert(Thread::current()->is_Java_thread(), "Must post from a JavaThread");
+  if (JvmtiEnv::environments_might_exist()) {
+    JvmtiEnvIterator it;
+    for (JvmtiEnvBase* env = it.first(); env != NULL; env = it.next(env)) {
+      JvmtiTagMap* tag_map = env->tag_map_acquire();
+      if (tag_map != NULL) {
+        tag_map->flush_object_free_events();
+      }
+    }
+  }
+}
+
+void JvmtiTagMap::flush_object_free_events() {
+  ResourceMark rm;
+  GrowableArray<jlong> objects;
+  {
+    MutexLocker ml(lock());
+    check_hashmap();
+    objects.appendAll(_dead_objects);
+    _dead_objects->clear();
+  }
+
+  if (objects.is_nonempty()) {
+    JvmtiExport::post_object_free(env(), &objects);
+    log_debug(jvmti, objecttagging)("%d ObjectFree events posted", objects.length());
+  }
+}
+
+// Processing of the hashmap is deferred from the GC to the next use of the
+// tag map, so that neither removing the entries of dead objects nor rehashing
+// the entries of moved objects has to be done in a GC pause.
+void JvmtiTagMap::check_hashmap() {
+  assert(SafepointSynchronize::is_at_safepoint() || is_locked(), "checking");
+
+  const bool rehash = Atomic::load(&_needs_rehashing);
+  const bool clean = Atomic::load(&_needs_cleaning);
+  if (!rehash && !clean) {
+    return;
+  }
+
+  // Reset before processing, so that a concurrent request is not lost
+  Atomic::store(&_needs_rehashing, false);
+  Atomic::store(&_needs_cleaning, false);
+
+  if (is_empty()) {
+    return;
+  }
 
   // does this environment have the OBJECT_FREE event enabled
-  bool post_object_free = env()->is_enabled(JVMTI_EVENT_OBJECT_FREE);
+  const bool post_object_free = env()->is_enabled(JVMTI_EVENT_OBJECT_FREE);
+  hashmap()->unlink_and_rehash(this, rehash, post_object_free ? _dead_objects : NULL);
+}
 
+void JvmtiTagMap::check_hashmaps_for_heapwalk() {
+  assert(SafepointSynchronize::is_at_safepoint(), "called from safepoints");
+  if (JvmtiEnv::environments_might_exist()) {
+    JvmtiEnvIterator it;
+    for (JvmtiEnvBase* env = it.first(); env != NULL; env = it.next(env)) {
+      JvmtiTagMap* tag_map = env->tag_map_acquire();
+      if (tag_map != NULL) {
+        tag_map->check_hashmap();
+      }
+    }
+  }
+}
+
+void JvmtiTagHashmap::unlink_and_rehash(JvmtiTagMap* tag_map, bool rehash, GrowableArray<jlong>* objects) {
   // counters used for trace message
   int freed = 0;
   int moved = 0;
 
-  JvmtiTagHashmap* hashmap = this->hashmap();
-
   // reenable sizing (if disabled)
-  hashmap->set_resizing_enabled(true);
-
-  // if the hashmap is empty then we can skip it
-  if (hashmap->_entry_count == 0) {
-    return;
-  }
+  set_resizing_enabled(true);
 
   // now iterate through each entry in the table
 
-  JvmtiTagHashmapEntry** table = hashmap->table();
-  int size = hashmap->size();
+  JvmtiTagHashmapEntry** table = this->table();
+  int size = this->size();
 
   JvmtiTagHashmapEntry* delayed_add = NULL;
 
@@ -3338,29 +3471,27 @@ void JvmtiTagMap::do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f) {
       JvmtiTagHashmapEntry* next = entry->next();
 
       // has object been GC'ed
-      if (!is_alive->do_object_b(entry->object_raw())) {
+      oop obj = entry->object_peek();
+      if (obj == NULL) {
         // grab the tag
         jlong tag = entry->tag();
         guarantee(tag != 0, "checking");
 
         // remove GC'ed entry from hashmap and return the
         // entry to the free list
-        hashmap->remove(prev, pos, entry);
-        destroy_entry(entry);
+        remove(prev, pos, entry);
+        tag_map->destroy_entry(entry);
 
-        // post the event to the profiler
-        if (post_object_free) {
-          JvmtiExport::post_object_free(env(), tag);
+        // record the tag for the ObjectFree event
+        if (objects != NULL) {
+          objects->append(tag);
         }
 
         ++freed;
-      } else {
-        f->do_oop(entry->object_addr());
-        oop new_oop = entry->object_raw();
-
+      } else if (rehash) {
         // if the object has moved then re-hash it and move its
         // entry to its new location.
-        unsigned int new_pos = JvmtiTagHashmap::hash(new_oop, size);
+        unsigned int new_pos = hash(obj, size);
         if (new_pos != (unsigned int)pos) {
           if (prev == NULL) {
             table[pos] = next;
@@ -3381,6 +3512,8 @@ void JvmtiTagMap::do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f) {
           // object didn't move
           prev = entry;
         }
+      } else {
+        prev = entry;
       }
 
       entry = next;
@@ -3390,12 +3523,12 @@ void JvmtiTagMap::do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f) {
   // Re-add all the entries which were kept aside
   while (delayed_add != NULL) {
     JvmtiTagHashmapEntry* next = delayed_add->next();
-    unsigned int pos = JvmtiTagHashmap::hash(delayed_add->object_raw(), size);
+    unsigned int pos = hash(delayed_add->object_peek(), size);
     delayed_add->set_next(table[pos]);
     table[pos] = delayed_add;
     delayed_add = next;
   }
 
   log_debug(jvmti, objecttagging)("(%d->%d, %d freed, %d total moves)",
-                                  hashmap->_entry_count + freed, hashmap->_entry_count, freed, moved);
+                                  _entry_count + freed, _entry_count, freed, moved);
 }
@@ -31,6 +31,7 @@
 #include "jvmtifiles/jvmti.h"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "memory/allocation.hpp"
+#include "utilities/growableArray.hpp"
 
 // forward references
 class JvmtiTagHashmap;
@@ -51,6 +52,12 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
   JvmtiTagHashmapEntry* _free_entries;              // free list for this environment
   int _free_entries_count;                          // number of entries on the free list
 
+  GrowableArray<jlong>* _dead_objects;              // tags of freed objects, not yet posted
+  volatile bool _needs_rehashing;                   // objects may have moved since last use
+  volatile bool _needs_cleaning;                    // objects may have died since last use
+
+  static bool _has_object_free_events;              // ObjectFree events pending, Service_lock
+
   // create a tag map
   JvmtiTagMap(JvmtiEnv* env);
 
@@ -58,7 +65,11 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
   inline Mutex* lock()                      { return &_lock; }
   inline JvmtiEnv* env() const              { return _env; }
 
-  void do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f);
+  // remove dead entries and rehash moved entries if the GC asked for it
+  void check_hashmap();
+
+  // post the ObjectFree events of this tag map
+  void flush_object_free_events();
 
   // iterate over all entries in this tag map
   void entry_iterate(JvmtiTagHashmapEntryClosure* closure);
@@ -120,8 +131,17 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
                                    jint* count_ptr, jobject** object_result_ptr,
                                    jlong** tag_result_ptr);
 
-  static void weak_oops_do(
-      BoolObjectClosure* is_alive, OopClosure* f) NOT_JVMTI_RETURN;
+  // GC support. The tagged objects are kept in the weak tag OopStorage,
+  // so the GC only notifies the tag maps that objects may have moved or
+  // died, and the tag maps process their hashmaps lazily on next use.
+  static void gc_notification() NOT_JVMTI_RETURN;
+  static void set_needs_rehashing() NOT_JVMTI_RETURN;
+  static void set_needs_cleaning() NOT_JVMTI_RETURN;
+  static void check_hashmaps_for_heapwalk() NOT_JVMTI_RETURN;
+
+  // ObjectFree events are posted by the ServiceThread
+  static bool has_object_free_events_and_reset() NOT_JVMTI_RETURN_(false);
+  static void flush_all_object_free_events() NOT_JVMTI_RETURN;
 };
 
 #endif // SHARE_PRIMS_JVMTITAGMAP_HPP
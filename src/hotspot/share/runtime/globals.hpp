@@ -718,6 +718,11 @@ const intx ObjectAlignmentInBytes = 8;
           "MonitorUsedDeflationThreshold is exceeded (0 is off).")          \
           range(0, max_jint)                                                \
                                                                             \
+  product(intx, MonitorDeflationMax, 1000000, DIAGNOSTIC,                    \
+          "The maximum number of in-use monitors to walk per async "        \
+          "deflation request (minimum is 1024).")                           \
+          range(1024, max_jint)                                             \
+                                                                            \
   product(intx, MonitorUsedDeflationThreshold, 90, EXPERIMENTAL,            \
           "Percentage of used monitors before triggering deflation (0 is "  \
           "off). The check is performed on GuaranteedSafepointInterval "    \
@@ -1141,6 +1146,13 @@ const intx ObjectAlignmentInBytes = 8;
           "If LogVMOutput or LogCompilation is on, save VM output to "      \
           "this file [default: ./hotspot_pid%p.log] (%p replaced with pid)")\
                                                                             \
+  product(uintx, AsyncLogBufferSize, 0, EXPERIMENTAL,                       \
+          "Number of messages buffered when writing unified logging file "  \
+          "outputs asynchronously from a dedicated thread. Messages are "   \
+          "dropped when the buffer is full. Zero writes file outputs "      \
+          "synchronously from the logging thread")                          \
+          range(0, max_jint)                                                \
+                                                                            \
   product(ccstr, ErrorFile, NULL,                                           \
           "If an error occurs, save the error data to this file "           \
           "[default: ./hs_err_pid%p.log] (%p replaced with pid)")           \
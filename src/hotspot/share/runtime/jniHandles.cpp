@@ -81,6 +81,69 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+oop* JNIHandleCache::allocate(OopStorage* storage) {
+  if (_count == 0) {
+    // Refill cache
+    _count = storage->allocate(_entries, RefillSize);
+    if (_count == 0) {
+      // Allocation failed
+      return NULL;
+    }
+  }
+
+  return _entries[--_count];
+}
+
+bool JNIHandleCache::free(oop* ptr) {
+  if (_count == CacheSize) {
+    // Cache full
+    return false;
+  }
+
+  _entries[_count++] = ptr;
+  return true;
+}
+
+void JNIHandleCache::release(OopStorage* storage) {
+  if (_count > 0) {
+    storage->release(_entries, _count);
+    _count = 0;
+  }
+}
+
+static JNIHandleCache* handle_cache(bool weak) {
+  Thread* const thread = Thread::current();
+  if (!thread->is_Java_thread()) {
+    return NULL;
+  }
+
+  JavaThread* const jt = thread->as_Java_thread();
+  return weak ? jt->weak_global_handle_cache() : jt->global_handle_cache();
+}
+
+static oop* allocate_entry(OopStorage* storage, bool weak) {
+  JNIHandleCache* const cache = handle_cache(weak);
+  if (cache == NULL) {
+    return storage->allocate();
+  }
+
+  return cache->allocate(storage);
+}
+
+static void release_entry(OopStorage* storage, oop* ptr, bool weak) {
+  // Entries of destroyed handles are not cached when checking JNI
+  // calls, since they must then be detected as no longer allocated.
+  JNIHandleCache* const cache = CheckJNICalls ? NULL : handle_cache(weak);
+  if (cache == NULL || !cache->free(ptr)) {
+    storage->release(ptr);
+  }
+}
+
+void JNIHandles::release_caches(JavaThread* thread) {
+  thread->global_handle_cache()->release(global_handles());
+  thread->weak_global_handle_cache()->release(weak_global_handles());
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_gc_active(), "can't extend the root set during GC");
   assert(!current_thread_in_native(), "must not be in native");
@@ -88,7 +151,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_entry(global_handles(), false /* weak */);
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
@@ -109,7 +172,7 @@ jobject JNIHandles::make_weak_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = weak_global_handles()->allocate();
+    oop* ptr = allocate_entry(weak_global_handles(), true /* weak */);
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
@@ -148,7 +211,7 @@ void JNIHandles::destroy_global(jobject handle) {
     assert(!is_jweak(handle), "wrong method for detroying jweak");
     oop* oop_ptr = jobject_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)NULL);
-    global_handles()->release(oop_ptr);
+    release_entry(global_handles(), oop_ptr, false /* weak */);
   }
 }
 
@@ -158,7 +221,7 @@ void JNIHandles::destroy_weak_global(jobject handle) {
     assert(is_jweak(handle), "JNI handle not jweak");
     oop* oop_ptr = jweak_ptr(handle);
     NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(oop_ptr, (oop)NULL);
-    weak_global_handles()->release(oop_ptr);
+    release_entry(weak_global_handles(), oop_ptr, true /* weak */);
   }
 }
 
@@ -128,6 +128,36 @@ class JNIHandles : AllStatic {
   static void weak_oops_do(OopClosure* f);
 
   static bool is_global_storage(const OopStorage* storage);
+
+  // Release the handle caches of an exiting thread
+  static void release_caches(JavaThread* thread);
+};
+
+// Thread-local cache of global or weak global handle entries.  Entries
+// are allocated from the OopStorage in batches, and entries of destroyed
+// handles are kept for reuse, so that creating and destroying handles
+// mostly avoids the storage allocation lock.  Cached entries are NULL.
+class JNIHandleCache {
+ private:
+  static const size_t CacheSize = 32;
+  static const size_t RefillSize = CacheSize / 2;
+
+  oop*   _entries[CacheSize];
+  size_t _count;
+
+ public:
+  JNIHandleCache() : _count(0) {}
+
+  // Allocate an entry, refilling the cache from the storage if empty.
+  // Returns NULL if allocation failed.
+  oop* allocate(OopStorage* storage);
+
+  // Cache the entry of a destroyed handle. Returns false if the cache
+  // is full, in which case the entry must be released to the storage.
+  bool free(oop* ptr);
+
+  // Release all cached entries back to the storage.
+  void release(OopStorage* storage);
 };
 
 
@@ -40,7 +40,10 @@ class CodeBlobClosure;
 //     Is done in 'do_stack_scanning()'. This function invokes a thread-local handshake
 //     that marks all nmethods that are active on a thread's stack, and resets their
 //     hotness counters. This allows the sweeper to assume that a decayed hotness counter
-//     of an nmethod implies that it is seemingly not used actively.
+//     of an nmethod implies that it is seemingly not used actively. GCs that arm their
+//     nmethod entry barriers every cycle also reset the hotness counter when a thread
+//     takes the barrier, which catches nmethods that were entered but not seen on any
+//     stack.
 //  2) sweep nmethods
 //     Is done in sweep_code_cache(). This function is the only place in the
 //     sweeper where memory is reclaimed. Note that sweep_code_cache() is not
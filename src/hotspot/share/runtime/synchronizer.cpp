@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/javaClasses.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
@@ -159,6 +160,19 @@ struct ObjectMonitorListGlobals {
 };
 static ObjectMonitorListGlobals om_list_globals;
 
+// Where an async deflation pass stopped when it used up its
+// MonitorDeflationMax budget. The next request continues the pass from
+// here instead of from the head of the in-use lists. Only the
+// ServiceThread reads or writes this.
+struct DeflationResumeState {
+  bool           _in_progress;   // A pass has been started but not finished.
+  int            _thread_index;  // -1 while in the global in-use list, else index in the ThreadsList.
+  JavaThread*    _thread;        // Owner of the per-thread in-use list _saved_mid is on.
+  jlong          _thread_id;     // java.lang.Thread id of _thread.
+  ObjectMonitor* _saved_mid;     // Resume point in the current list; NULL starts at its head.
+};
+static DeflationResumeState deflation_resume;
+
 
 // =====================> Spin-lock functions
 
@@ -1352,6 +1366,10 @@ bool ObjectSynchronizer::is_async_deflation_needed() {
     // Async deflation request.
     return true;
   }
+  if (deflation_resume._in_progress) {
+    // The last request used up its budget before the pass finished.
+    return true;
+  }
   if (AsyncDeflationInterval > 0 &&
       time_since_last_async_deflation_ms() > AsyncDeflationInterval &&
       monitors_used_above_threshold()) {
@@ -2186,14 +2204,16 @@ bool ObjectSynchronizer::deflate_monitor_using_JT(ObjectMonitor* mid,
 // Walk a given ObjectMonitor list and deflate idle ObjectMonitors using
 // a JavaThread. Returns the number of deflated ObjectMonitors. The given
 // list could be a per-thread in-use list or the global in-use list.
-// If a safepoint has started, then we save state via saved_mid_in_use_p
-// and return to the caller to honor the safepoint.
+// Every ObjectMonitor walked is charged against *budget_p. If a safepoint
+// has started or the budget has been used up, then we save state via
+// saved_mid_in_use_p and return to the caller.
 //
 int ObjectSynchronizer::deflate_monitor_list_using_JT(ObjectMonitor** list_p,
                                                       int* count_p,
                                                       ObjectMonitor** free_head_p,
                                                       ObjectMonitor** free_tail_p,
-                                                      ObjectMonitor** saved_mid_in_use_p) {
+                                                      ObjectMonitor** saved_mid_in_use_p,
+                                                      int* budget_p) {
   JavaThread* self = JavaThread::current();
 
   ObjectMonitor* cur_mid_in_use = NULL;
@@ -2236,6 +2256,7 @@ int ObjectSynchronizer::deflate_monitor_list_using_JT(ObjectMonitor** list_p,
   while (true) {
     // The current mid is locked at this point. If we have a
     // cur_mid_in_use, then it is also locked at this point.
+    (*budget_p)--;
 
     if (next != NULL) {
       // We lock next so that an om_flush() thread that is behind us
@@ -2296,14 +2317,15 @@ int ObjectSynchronizer::deflate_monitor_list_using_JT(ObjectMonitor** list_p,
       mid = next;  // mid keeps non-NULL next's locked state
       next = next_next;
 
-      if (SafepointMechanism::should_process(self) &&
+      if ((SafepointMechanism::should_process(self) || *budget_p <= 0) &&
           // Acquire semantics are not needed on this list load since
           // it is not dependent on the following load which does have
           // acquire semantics.
           cur_mid_in_use != Atomic::load(list_p) && cur_mid_in_use->is_old()) {
-        // If a safepoint has started and cur_mid_in_use is not the list
-        // head and is old, then it is safe to use as saved state. Return
-        // to the caller before blocking.
+        // If a safepoint has started or the budget is used up and
+        // cur_mid_in_use is not the list head and is old, then it is
+        // safe to use as saved state. Return to the caller before
+        // blocking or giving up.
         *saved_mid_in_use_p = cur_mid_in_use;
         om_unlock(cur_mid_in_use);
         if (mid != NULL) {
@@ -2338,22 +2360,88 @@ class HandshakeForDeflation : public HandshakeClosure {
   }
 };
 
-void ObjectSynchronizer::deflate_idle_monitors_using_JT() {
-  // Deflate any global idle monitors.
-  deflate_global_idle_monitors_using_JT();
+// Returns the java.lang.Thread id of jt or 0 if it does not have one yet.
+// Unlike the JavaThread* this is never reused for another thread.
+static jlong deflation_thread_id(JavaThread* jt) {
+  oop thread_obj = jt->threadObj();
+  return thread_obj != NULL ? java_lang_Thread::thread_id(thread_obj) : 0;
+}
 
-  int count = 0;
-  for (JavaThreadIteratorWithHandle jtiwh; JavaThread *jt = jtiwh.next(); ) {
-    if (Atomic::load(&jt->om_in_use_count) > 0 && !jt->is_exiting()) {
-      // This JavaThread is using ObjectMonitors so deflate any that
-      // are idle unless this JavaThread is exiting; do not race with
-      // ObjectSynchronizer::om_flush().
-      deflate_per_thread_idle_monitors_using_JT(jt);
-      count++;
+// Returns the index in t_list at which the per-thread part of the
+// current async deflation pass continues. The saved resume point is
+// only kept if it still belongs to the same live JavaThread; otherwise
+// that thread's list is walked again from its head.
+static uint deflation_resume_index(ThreadsList* t_list) {
+  uint index = MIN2((uint)deflation_resume._thread_index, t_list->length());
+  JavaThread* jt = deflation_resume._thread;
+  if (jt != NULL) {
+    int found = t_list->find_index_of_JavaThread(jt);
+    if (found != -1 && !jt->is_exiting() && deflation_resume._thread_id != 0 &&
+        deflation_thread_id(jt) == deflation_resume._thread_id) {
+      return (uint)found;
     }
   }
-  if (count > 0) {
-    log_debug(monitorinflation)("did async deflation of idle monitors for %d thread(s).", count);
+  deflation_resume._saved_mid = NULL;
+  return index;
+}
+
+void ObjectSynchronizer::deflate_idle_monitors_using_JT() {
+  // Bound the number of monitors walked per request so that the
+  // ServiceThread can get to its other work. A pass that does not fit
+  // into the budget is continued from deflation_resume by the next
+  // request.
+  int budget = (int)MonitorDeflationMax;
+
+  if (!deflation_resume._in_progress) {
+    // Start a new pass at the head of the global in-use list.
+    deflation_resume._in_progress = true;
+    deflation_resume._thread_index = -1;
+    deflation_resume._thread = NULL;
+    deflation_resume._thread_id = 0;
+    deflation_resume._saved_mid = NULL;
+  }
+
+  if (deflation_resume._thread_index < 0) {
+    // Deflate any global idle monitors.
+    deflate_global_idle_monitors_using_JT(&deflation_resume._saved_mid, &budget);
+    if (deflation_resume._saved_mid == NULL) {
+      // The global in-use list is done; move on to the per-thread lists.
+      deflation_resume._thread_index = 0;
+    }
+  }
+
+  bool pass_finished = false;
+  if (deflation_resume._thread_index >= 0) {
+    ThreadsListHandle tlh;
+    int count = 0;
+    uint i = deflation_resume_index(tlh.list());
+    for (; i < tlh.length() && budget > 0; i++) {
+      JavaThread* jt = tlh.thread_at(i);
+      if (Atomic::load(&jt->om_in_use_count) > 0 && !jt->is_exiting()) {
+        // This JavaThread is using ObjectMonitors so deflate any that
+        // are idle unless this JavaThread is exiting; do not race with
+        // ObjectSynchronizer::om_flush().
+        deflate_per_thread_idle_monitors_using_JT(jt, &deflation_resume._saved_mid, &budget);
+        count++;
+        if (deflation_resume._saved_mid != NULL) {
+          // The budget was used up part way through jt's list.
+          deflation_resume._thread = jt;
+          deflation_resume._thread_id = deflation_thread_id(jt);
+          break;
+        }
+      } else {
+        deflation_resume._saved_mid = NULL;
+      }
+    }
+    if (count > 0) {
+      log_debug(monitorinflation)("did async deflation of idle monitors for %d thread(s).", count);
+    }
+    if (deflation_resume._saved_mid == NULL) {
+      deflation_resume._thread = NULL;
+      deflation_resume._thread_id = 0;
+    }
+    deflation_resume._thread_index = (int)i;
+    pass_finished = (i >= tlh.length());
   }
 
   log_info(monitorinflation)("async global_population=%d, global_in_use_count=%d, "
@@ -2365,9 +2453,17 @@ void ObjectSynchronizer::deflate_idle_monitors_using_JT() {
 
   GVars.stw_random = os::random();
 
-  // The ServiceThread's async deflation request has been processed.
-  _last_async_deflation_time_ns = os::javaTimeNanos();
-  set_is_async_deflation_requested(false);
+  if (pass_finished) {
+    // The ServiceThread's async deflation request has been processed.
+    deflation_resume._in_progress = false;
+    _last_async_deflation_time_ns = os::javaTimeNanos();
+    set_is_async_deflation_requested(false);
+  } else {
+    // The budget was used up before all the in-use lists were walked;
+    // is_async_deflation_needed() brings the ServiceThread back here.
+    log_debug(monitorinflation)("async deflation budget of " INTX_FORMAT " monitors used up, continuing later.",
+                                MonitorDeflationMax);
+  }
 
   if (Atomic::load(&om_list_globals._wait_count) > 0) {
     // There are deflated ObjectMonitors waiting for a handshake
@@ -2408,29 +2504,37 @@ void ObjectSynchronizer::deflate_idle_monitors_using_JT() {
 
 // Deflate global idle ObjectMonitors using a JavaThread.
 //
-void ObjectSynchronizer::deflate_global_idle_monitors_using_JT() {
+int ObjectSynchronizer::deflate_global_idle_monitors_using_JT(ObjectMonitor** saved_mid_in_use_p,
+                                                              int* budget_p) {
   JavaThread* self = JavaThread::current();
 
-  deflate_common_idle_monitors_using_JT(true /* is_global */, self);
+  return deflate_common_idle_monitors_using_JT(true /* is_global */, self, saved_mid_in_use_p, budget_p);
 }
 
 // Deflate the specified JavaThread's idle ObjectMonitors using a JavaThread.
 //
-void ObjectSynchronizer::deflate_per_thread_idle_monitors_using_JT(JavaThread* target) {
+int ObjectSynchronizer::deflate_per_thread_idle_monitors_using_JT(JavaThread* target,
+                                                                  ObjectMonitor** saved_mid_in_use_p,
+                                                                  int* budget_p) {
   assert(Thread::current()->is_Java_thread(), "precondition");
 
-  deflate_common_idle_monitors_using_JT(false /* !is_global */, target);
+  return deflate_common_idle_monitors_using_JT(false /* !is_global */, target, saved_mid_in_use_p, budget_p);
 }
 
 // Deflate global or per-thread idle ObjectMonitors using a JavaThread.
+// The walk starts after *saved_mid_in_use_p if it is not NULL. Once
+// *budget_p ObjectMonitors have been walked, the walk stops and leaves
+// its resume point in *saved_mid_in_use_p. Returns the number of
+// deflated ObjectMonitors.
 //
-void ObjectSynchronizer::deflate_common_idle_monitors_using_JT(bool is_global, JavaThread* target) {
+int ObjectSynchronizer::deflate_common_idle_monitors_using_JT(bool is_global, JavaThread* target,
+                                                              ObjectMonitor** saved_mid_in_use_p,
+                                                              int* budget_p) {
   JavaThread* self = JavaThread::current();
 
   int deflated_count = 0;
   ObjectMonitor* free_head_p = NULL;  // Local SLL of scavenged ObjectMonitors
   ObjectMonitor* free_tail_p = NULL;
-  ObjectMonitor* saved_mid_in_use_p = NULL;
   elapsedTimer timer;
 
   if (log_is_enabled(Info, monitorinflation)) {
@@ -2450,12 +2554,13 @@ void ObjectSynchronizer::deflate_common_idle_monitors_using_JT(bool is_global, J
           deflate_monitor_list_using_JT(&om_list_globals._in_use_list,
                                         &om_list_globals._in_use_count,
                                         &free_head_p, &free_tail_p,
-                                        &saved_mid_in_use_p);
+                                        saved_mid_in_use_p, budget_p);
     } else {
       local_deflated_count =
           deflate_monitor_list_using_JT(&target->om_in_use_list,
                                         &target->om_in_use_count, &free_head_p,
-                                        &free_tail_p, &saved_mid_in_use_p);
+                                        &free_tail_p, saved_mid_in_use_p,
+                                        budget_p);
     }
     deflated_count += local_deflated_count;
 
@@ -2480,7 +2585,13 @@ void ObjectSynchronizer::deflate_common_idle_monitors_using_JT(bool is_global, J
       OM_PERFDATA_OP(Deflations, inc(local_deflated_count));
     }
 
-    if (saved_mid_in_use_p != NULL) {
+    if (*saved_mid_in_use_p != NULL && *budget_p <= 0) {
+      // deflate_monitor_list_using_JT() used up the budget. The rest
+      // of the list is left for the next async deflation request.
+      break;
+    }
+
+    if (*saved_mid_in_use_p != NULL) {
       // deflate_monitor_list_using_JT() detected a safepoint starting.
       timer.stop();
       {
@@ -2499,7 +2610,7 @@ void ObjectSynchronizer::deflate_common_idle_monitors_using_JT(bool is_global, J
         timer.start();
       }
     }
-  } while (saved_mid_in_use_p != NULL);
+  } while (*saved_mid_in_use_p != NULL);
   timer.stop();
 
   LogStreamHandle(Debug, monitorinflation) lsh_debug;
@@ -2517,6 +2628,8 @@ void ObjectSynchronizer::deflate_common_idle_monitors_using_JT(bool is_global, J
       ls->print_cr("jt=" INTPTR_FORMAT ": async-deflating per-thread idle monitors, %3.7f secs, %d monitors", p2i(target), timer.seconds(), deflated_count);
     }
   }
+
+  return deflated_count;
 }
 
 // Monitor cleanup on JavaThread::exit
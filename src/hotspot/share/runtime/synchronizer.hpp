@@ -130,9 +130,14 @@ class ObjectSynchronizer : AllStatic {
   // Basically we deflate all monitors that are not busy.
   // An adaptive profile-based deflation policy could be used if needed
   static void deflate_idle_monitors_using_JT();
-  static void deflate_global_idle_monitors_using_JT();
-  static void deflate_per_thread_idle_monitors_using_JT(JavaThread* target);
-  static void deflate_common_idle_monitors_using_JT(bool is_global, JavaThread* target);
+  static int deflate_global_idle_monitors_using_JT(ObjectMonitor** saved_mid_in_use_p,
+                                                  int* budget_p);
+  static int deflate_per_thread_idle_monitors_using_JT(JavaThread* target,
+                                                      ObjectMonitor** saved_mid_in_use_p,
+                                                      int* budget_p);
+  static int deflate_common_idle_monitors_using_JT(bool is_global, JavaThread* target,
+                                                  ObjectMonitor** saved_mid_in_use_p,
+                                                  int* budget_p);
 
   // For a given in-use monitor list: global or per-thread, deflate idle
   // monitors using a JavaThread.
@@ -140,7 +145,8 @@ class ObjectSynchronizer : AllStatic {
                                            int* count_p,
                                            ObjectMonitor** free_head_p,
                                            ObjectMonitor** free_tail_p,
-                                           ObjectMonitor** saved_mid_in_use_p);
+                                           ObjectMonitor** saved_mid_in_use_p,
+                                           int* budget_p);
   static bool deflate_monitor_using_JT(ObjectMonitor* mid,
                                        ObjectMonitor** free_head_p,
                                        ObjectMonitor** free_tail_p);
@@ -1064,6 +1064,10 @@ class JavaThread: public Thread {
 
   JNIEnv        _jni_environment;
 
+  // Caches of JNI global and weak global handle entries
+  JNIHandleCache _global_handle_cache;
+  JNIHandleCache _weak_global_handle_cache;
+
   // Deopt support
   DeoptResourceMark*  _deopt_mark;               // Holds special ResourceMark for deoptimization
 
@@ -1835,6 +1839,9 @@ class JavaThread: public Thread {
   // Returns the jni environment for this thread
   JNIEnv* jni_environment()                      { return &_jni_environment; }
 
+  JNIHandleCache* global_handle_cache()          { return &_global_handle_cache; }
+  JNIHandleCache* weak_global_handle_cache()     { return &_weak_global_handle_cache; }
+
   static JavaThread* thread_from_jni_environment(JNIEnv* env) {
     JavaThread *thread_from_jni_env = (JavaThread*)((intptr_t)env - in_bytes(jni_environment_offset()));
     // Only return NULL if thread is off the thread list; starting to
@@ -386,6 +386,31 @@ TEST_VM_F(OopStorageTest, allocate_many) {
   }
 }
 
+TEST_VM_F(OopStorageTest, bulk_allocation) {
+  static const size_t max_entries = 1000;
+  static const size_t zero = 0;
+  oop* entries[max_entries] = {};
+
+  AllocationList& allocation_list = TestAccess::allocation_list(_storage);
+
+  EXPECT_EQ(0u, empty_block_count(_storage));
+  size_t allocated = _storage.allocate(entries, max_entries);
+  ASSERT_EQ(max_entries, allocated);
+  EXPECT_EQ(max_entries, _storage.allocation_count());
+  for (size_t i = 0; i < max_entries; ++i) {
+    ASSERT_TRUE(entries[i] != NULL);
+    EXPECT_TRUE(*entries[i] == NULL);
+    for (size_t j = 0; j < i; ++j) {
+      EXPECT_NE(entries[i], entries[j]);
+    }
+  }
+
+  _storage.release(entries, max_entries);
+  EXPECT_EQ(zero, total_allocation_count(_storage));
+  EXPECT_EQ(active_count(_storage), list_length(allocation_list));
+  EXPECT_EQ(active_count(_storage), empty_block_count(_storage));
+}
+
 TEST_VM_F(OopStorageTestWithAllocation, random_release) {
   static const size_t step = 11;
   ASSERT_NE(0u, _max_entries % step); // max_entries and step are mutually prime
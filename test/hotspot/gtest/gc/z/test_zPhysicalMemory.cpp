@@ -172,3 +172,73 @@ TEST(ZPhysicalMemoryTest, split_committed) {
   EXPECT_EQ(pmem1.nsegments(), 2);
   EXPECT_EQ(pmem1.size(), 20u);
 }
+
+TEST(ZPhysicalMemoryTest, is_before) {
+  ZPhysicalMemory pmem0;
+  pmem0.add_segment(ZPhysicalMemorySegment(100, 10, true));
+
+  ZPhysicalMemory pmem1;
+  pmem1.add_segment(ZPhysicalMemorySegment(0, 10, true));
+  pmem1.add_segment(ZPhysicalMemorySegment(200, 10, true));
+
+  ZPhysicalMemory pmem2;
+  pmem2.add_segment(ZPhysicalMemorySegment(110, 10, true));
+
+  const ZPhysicalMemory null;
+  EXPECT_TRUE(null.is_before(pmem0));
+  EXPECT_TRUE(pmem0.is_before(null));
+  EXPECT_TRUE(pmem0.is_before(pmem2));
+  EXPECT_FALSE(pmem2.is_before(pmem0));
+  EXPECT_FALSE(pmem0.is_before(pmem1));
+  EXPECT_FALSE(pmem1.is_before(pmem0));
+}
+
+TEST(ZPhysicalMemoryTest, merge_out_of_order) {
+  // Two adjacent virtual ranges, where the first is backed by
+  // physically higher memory than the second.
+  ZPhysicalMemory first;
+  first.add_segment(ZPhysicalMemorySegment(100, 10, true));
+  ZPhysicalMemory second;
+  second.add_segment(ZPhysicalMemorySegment(0, 10, true));
+  EXPECT_FALSE(first.is_before(second));
+
+  // Merging would sort the segments by physical address, so that
+  // splitting off the first virtual range hands out the wrong memory.
+  ZPhysicalMemory merged;
+  merged.add_segments(first);
+  merged.add_segments(second);
+  ZPhysicalMemory split = merged.split(10);
+  EXPECT_EQ(split.nsegments(), 1);
+  EXPECT_NE(split.segment(0).start(), first.segment(0).start());
+}
+
+TEST(ZPhysicalMemoryTest, merge_in_order) {
+  ZPhysicalMemory first;
+  first.add_segment(ZPhysicalMemorySegment(0, 10, true));
+  first.add_segment(ZPhysicalMemorySegment(20, 10, true));
+  ZPhysicalMemory second;
+  second.add_segment(ZPhysicalMemorySegment(30, 10, true));
+  second.add_segment(ZPhysicalMemorySegment(50, 10, true));
+  EXPECT_TRUE(first.is_before(second));
+
+  ZPhysicalMemory merged;
+  merged.add_segments(first);
+  merged.add_segments(second);
+  EXPECT_EQ(merged.nsegments(), 3);
+  EXPECT_EQ(merged.size(), 40u);
+
+  // Uncommitting the tail only touches the second virtual range
+  EXPECT_TRUE(merged.uncommit_segment(2, 10));
+  EXPECT_FALSE(merged.segment(2).is_committed());
+  EXPECT_EQ(merged.segment(2).start(), 50u);
+
+  // Splitting off the first virtual range hands back its own memory
+  ZPhysicalMemory split = merged.split(20);
+  EXPECT_EQ(split.nsegments(), 2);
+  EXPECT_EQ(split.segment(0).start(), 0u);
+  EXPECT_EQ(split.segment(1).start(), 20u);
+  EXPECT_EQ(split.segment(1).size(), 10u);
+  EXPECT_EQ(merged.nsegments(), 2);
+  EXPECT_EQ(merged.segment(0).start(), 30u);
+  EXPECT_EQ(merged.segment(1).start(), 50u);
+}
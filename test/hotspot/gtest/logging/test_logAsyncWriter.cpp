@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "logTestFixture.hpp"
+#include "logTestUtils.inline.hpp"
+#include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
+#include "unittest.hpp"
+
+#define DROPPED_REPORT_STR "[1 messages dropped due to full async log buffer]"
+
+// Runs the tests against an AsyncLogWriter that is installed as the instance,
+// but whose thread is never started. Buffered messages are only written when
+// the test asks for it.
+class AsyncLogWriterTest : public LogTestFixture {
+ private:
+  AsyncLogWriter* _saved_instance;
+
+ protected:
+  AsyncLogWriter* _writer;
+
+  AsyncLogWriterTest() : _saved_instance(AsyncLogWriter::_instance), _writer(NULL) {}
+
+  void install(size_t capacity) {
+    _writer = new AsyncLogWriter(capacity);
+    AsyncLogWriter::_instance = _writer;
+  }
+
+  size_t count() const {
+    return _writer->_count;
+  }
+
+  void write() {
+    _writer->write();
+  }
+
+  virtual void TearDown() {
+    AsyncLogWriter::_instance = _saved_instance;
+    delete _writer;
+  }
+};
+
+TEST_VM_F(AsyncLogWriterTest, drop_when_full) {
+  set_log_config(TestLogFileName, "logging=info");
+  install(2);
+
+  log_info(logging)("message 1");
+  log_info(logging)("message 2");
+  log_info(logging)("message 3");
+  EXPECT_EQ(2u, count()) << "Messages beyond the capacity should be dropped";
+
+  write();
+  EXPECT_EQ(0u, count());
+  EXPECT_TRUE(file_contains_substring(TestLogFileName, "message 2"));
+  EXPECT_FALSE(file_contains_substring(TestLogFileName, "message 3"));
+  EXPECT_FALSE(file_contains_substring(TestLogFileName, DROPPED_REPORT_STR))
+      << "Dropped messages should be reported with the next message";
+
+  log_info(logging)("message 4");
+  write();
+  const char* expected[] = { "message 1", "message 2", DROPPED_REPORT_STR, "message 4", NULL };
+  EXPECT_TRUE(file_contains_substrings_in_order(TestLogFileName, expected));
+}
+
+TEST_VM_F(AsyncLogWriterTest, flush_reports_dropped) {
+  set_log_config(TestLogFileName, "logging=info");
+  install(2);
+
+  log_info(logging)("message 1");
+  log_info(logging)("message 2");
+  log_info(logging)("message 3");
+
+  AsyncLogWriter::flush();
+  EXPECT_EQ(0u, count());
+  const char* expected[] = { "message 1", "message 2", DROPPED_REPORT_STR, NULL };
+  EXPECT_TRUE(file_contains_substrings_in_order(TestLogFileName, expected))
+      << "Dropped messages should be reported on flush";
+
+  // Reported only once
+  AsyncLogWriter::flush();
+  const char* reported_twice[] = { DROPPED_REPORT_STR, DROPPED_REPORT_STR, NULL };
+  EXPECT_FALSE(file_contains_substrings_in_order(TestLogFileName, reported_twice));
+}
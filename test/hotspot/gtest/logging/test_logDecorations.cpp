@@ -81,6 +81,23 @@ TEST_VM(LogDecorations, tags) {
   EXPECT_STREQ(expected_tags, decorations.decoration(LogDecorators::tags_decorator));
 }
 
+TEST_VM(LogDecorations, copy) {
+  LogDecorations decorations(LogLevel::Info, tagset, default_decorators);
+  LogDecorations copy(decorations);
+  // Verify that the copy has its own, but equal, decorations
+  for (uint d = 0; d < LogDecorators::Count; d++) {
+    LogDecorators::Decorator decorator = static_cast<LogDecorators::Decorator>(d);
+    const char* original = decorations.decoration(decorator);
+    const char* copied = copy.decoration(decorator);
+    if (original == NULL) {
+      EXPECT_TRUE(copied == NULL);
+    } else if (decorator != LogDecorators::level_decorator) {
+      EXPECT_NE(original, copied);
+      EXPECT_STREQ(original, copied);
+    }
+  }
+}
+
 // Test each variation of the different timestamp decorations (ms, ns, uptime ms, uptime ns)
 TEST_VM(LogDecorations, timestamps) {
   struct {
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.z;
+
+/*
+ * @test TestMarkStackOverflow
+ * @requires vm.gc.Z
+ * @summary Test that marking completes when the mark stack space is exhausted
+ * @library /test/lib
+ * @run driver gc.z.TestMarkStackOverflow
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestMarkStackOverflow {
+    static class Holder {
+        Object o;
+    }
+
+    // Every field except the one followed first stays on the mark
+    // stack until the end of the chain has been reached. The next
+    // node is referenced from both ends of the field list, so that
+    // this holds regardless of the order in which fields are pushed.
+    static class Node {
+        Node next0;
+        Holder h0, h1, h2, h3, h4, h5, h6, h7;
+        Node next1;
+
+        Node(Node next, Holder h) {
+            next0 = next1 = next;
+            h0 = h1 = h2 = h3 = h4 = h5 = h6 = h7 = h;
+        }
+    }
+
+    static class Test {
+        private static final int nodes = 1_000_000;
+
+        public static void main(String[] args) throws Exception {
+            final Holder holder = new Holder();
+            Node head = null;
+            for (int i = 0; i < nodes; i++) {
+                head = new Node(head, holder);
+            }
+
+            for (int i = 0; i < 2; i++) {
+                System.gc();
+            }
+
+            int count = 0;
+            for (Node node = head; node != null; node = node.next0) {
+                if (node.next0 != node.next1 || node.h7 != holder) {
+                    throw new RuntimeException("Corrupt node " + count);
+                }
+                count++;
+            }
+
+            if (count != nodes) {
+                throw new RuntimeException("Lost nodes, found " + count);
+            }
+
+            System.out.println("Chain verified");
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-XX:+UseZGC",
+                "-Xmx512M",
+                "-XX:ZMarkStackSpaceLimit=32M",
+                "-XX:ParallelGCThreads=1",
+                "-XX:ConcGCThreads=1",
+                "-Xlog:gc,gc+marking",
+                Test.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Chain verified");
+
+        // The overflow is reported once per GC cycle
+        final long reports = output.asLines().stream()
+                .filter(line -> line.contains("Mark stack space exhausted"))
+                .count();
+        if (reports < 2) {
+            throw new RuntimeException("Expected mark stack overflow in every cycle, found " + reports);
+        }
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.z;
+
+/*
+ * @test TestMetaspaceResize
+ * @requires vm.gc.Z
+ * @summary Test that metaspace is resized concurrently after class unloading
+ * @library /test/lib
+ * @run driver gc.z.TestMetaspaceResize
+ */
+
+import java.io.InputStream;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestMetaspaceResize {
+    private static final int cycles = 3;
+
+    static class Payload {}
+
+    static class PayloadLoader extends ClassLoader {
+        private final byte[] bytes;
+
+        PayloadLoader(byte[] bytes) {
+            super(PayloadLoader.class.getClassLoader());
+            this.bytes = bytes;
+        }
+
+        @Override
+        protected Class<?> loadClass(String name, boolean resolve) throws ClassNotFoundException {
+            if (name.equals(Payload.class.getName())) {
+                // Define a new copy of the class in this loader
+                return defineClass(name, bytes, 0, bytes.length);
+            }
+
+            return super.loadClass(name, resolve);
+        }
+    }
+
+    static class Test {
+        private static final int loaders = 10_000;
+
+        public static Object dummy;
+
+        public static void main(String[] args) throws Exception {
+            final String resource = Payload.class.getName().replace('.', '/') + ".class";
+            final byte[] bytes;
+            try (InputStream in = ClassLoader.getSystemResourceAsStream(resource)) {
+                bytes = in.readAllBytes();
+            }
+
+            for (int i = 0; i < cycles; i++) {
+                // Load classes in loaders that immediately become unreachable
+                for (int j = 0; j < loaders; j++) {
+                    dummy = new PayloadLoader(bytes).loadClass(Payload.class.getName());
+                }
+                dummy = null;
+
+                System.gc();
+            }
+
+            System.out.println("Test done");
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-XX:+UseZGC",
+                "-Xmx256M",
+                "-XX:+ClassUnloading",
+                "-Xlog:gc,gc+metaspace=trace,class+unload",
+                Test.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Test done");
+        output.shouldContain("unloading class " + Payload.class.getName());
+
+        // Metaspace is resized once per GC cycle
+        final long resizes = output.asLines().stream()
+                .filter(line -> line.contains("MetaspaceGC::compute_new_size"))
+                .count();
+        if (resizes < cycles) {
+            throw new RuntimeException("Expected metaspace to be resized at least " + cycles + " times, found " + resizes);
+        }
+    }
+}
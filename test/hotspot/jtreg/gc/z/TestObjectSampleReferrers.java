@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.z;
+
+/*
+ * @test TestObjectSampleReferrers
+ * @requires vm.gc.Z & vm.hasJFR
+ * @summary Test that reference chains of old object samples end in a real GC root
+ *          when the referrers of the samples are recorded during marking
+ * @library /test/lib
+ * @run main/othervm -XX:+UseZGC -XX:+UnlockExperimentalVMOptions -XX:+ZRecordObjectSampleReferrers
+ *                   -XX:TLABSize=2k gc.z.TestObjectSampleReferrers
+ */
+
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordedObject;
+import jdk.jfr.consumer.RecordingFile;
+
+public class TestObjectSampleReferrers {
+    static class Leak {}
+
+    // Keeps the leaked objects a few references away from the root
+    static class Holder {
+        Holder next;
+        Object[] leaks;
+    }
+
+    private static final int leaks = 100_000;
+
+    public static Holder holder;
+
+    private static boolean hasHolder(RecordedObject object) {
+        // Walk the reference chain from the sample object towards the root
+        while (object != null) {
+            if (object.getClass("type").getName().equals(Holder.class.getName())) {
+                return true;
+            }
+
+            final RecordedObject referrer = object.getValue("referrer");
+            object = (referrer == null) ? null : referrer.getValue("object");
+        }
+
+        return false;
+    }
+
+    public static void main(String[] args) throws Exception {
+        final Path file = Paths.get("referrers.jfr");
+
+        try (Recording recording = new Recording()) {
+            recording.enable("jdk.OldObjectSample").withoutStackTrace().with("cutoff", "infinity");
+            recording.start();
+
+            holder = new Holder();
+            holder.next = new Holder();
+            holder.next.leaks = new Object[leaks];
+            for (int i = 0; i < leaks; i++) {
+                holder.next.leaks[i] = new Leak();
+            }
+
+            // Record referrers of the samples while marking
+            System.gc();
+
+            recording.stop();
+            recording.dump(file);
+        }
+
+        int samples = 0;
+        for (RecordedEvent event : RecordingFile.readAllEvents(file)) {
+            final RecordedObject object = event.getValue("object");
+            if (!object.getClass("type").getName().equals(Leak.class.getName())) {
+                continue;
+            }
+
+            samples++;
+
+            if (event.getValue("root") == null) {
+                throw new RuntimeException("Sample without GC root: " + event);
+            }
+
+            if (!hasHolder(object)) {
+                throw new RuntimeException("Reference chain does not reach the root through the holders: " + event);
+            }
+        }
+
+        if (samples == 0) {
+            throw new RuntimeException("No old object samples of " + Leak.class.getName() + " found");
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.z;
+
+/*
+ * @test TestPageAge
+ * @requires vm.gc.Z
+ * @summary Test that the page age histogram is logged and tracks surviving pages
+ * @library /test/lib
+ * @run driver gc.z.TestPageAge
+ */
+
+import java.util.ArrayList;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPageAge {
+    static class Test {
+        private static final int cycles = 5;
+        private static final int objects = 100_000;
+
+        public static Object[] retained;
+        public static Object dummy;
+
+        public static void main(String[] args) throws Exception {
+            // Long-lived objects, which should end up on old pages
+            retained = new Object[objects];
+            for (int i = 0; i < objects; i++) {
+                retained[i] = new byte[64];
+            }
+
+            for (int i = 0; i < cycles; i++) {
+                // Short-lived objects, which should die on young pages.
+                // Every other long-lived object is replaced, to leave
+                // fragmented old pages behind for relocation.
+                for (int j = 0; j < objects; j++) {
+                    dummy = new byte[64];
+                    if (j % 2 == i % 2) {
+                        retained[j] = new byte[64];
+                    }
+                }
+
+                System.gc();
+            }
+
+            System.out.println("Test done");
+        }
+    }
+
+    private static final Pattern agePattern =
+            Pattern.compile("Age +(\\d+)\\+?: Pages: (\\d+), Total: (\\d+)M, Live: (\\d+)M");
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-XX:+UseZGC",
+                "-Xmx256M",
+                "-Xlog:gc+reloc=debug",
+                Test.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Test done");
+        output.shouldContain("Page Age Survival:");
+
+        final ArrayList<Integer> ages = new ArrayList<>();
+        for (String line : output.asLines()) {
+            final Matcher matcher = agePattern.matcher(line);
+            if (!matcher.find()) {
+                continue;
+            }
+
+            final int age = Integer.parseInt(matcher.group(1));
+            final long pages = Long.parseLong(matcher.group(2));
+            final long total = Long.parseLong(matcher.group(3));
+            final long live = Long.parseLong(matcher.group(4));
+
+            if (age > 15) {
+                throw new RuntimeException("Invalid age: " + line);
+            }
+            if (pages == 0) {
+                throw new RuntimeException("Empty age bucket logged: " + line);
+            }
+            if (live > total) {
+                throw new RuntimeException("More live than total: " + line);
+            }
+
+            ages.add(age);
+        }
+
+        if (!ages.contains(0)) {
+            throw new RuntimeException("No young pages found");
+        }
+        if (ages.stream().noneMatch(age -> age > 0)) {
+            throw new RuntimeException("No old pages found");
+        }
+    }
+}
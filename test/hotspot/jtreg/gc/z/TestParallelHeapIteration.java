@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.z;
+
+/*
+ * @test TestParallelHeapIteration
+ * @requires vm.gc.Z
+ * @summary Test that parallel heap iteration visits every element of a large object array once
+ * @library /test/lib
+ * @run main/othervm -XX:+UseZGC -Xmx512M gc.z.TestParallelHeapIteration
+ */
+
+import jdk.test.lib.JDKToolLauncher;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestParallelHeapIteration {
+    static class Element {}
+
+    // Large enough to be split into many chunks
+    private static final int elements = 1_000_000;
+
+    public static Object[] array;
+
+    public static void main(String[] args) throws Exception {
+        array = new Object[elements];
+        for (int i = 0; i < elements; i++) {
+            array[i] = new Element();
+        }
+
+        // The class histogram is collected with a parallel heap iteration
+        final JDKToolLauncher launcher = JDKToolLauncher.createUsingTestJDK("jmap");
+        launcher.addToolArg("-histo:parallel=4");
+        launcher.addToolArg(Long.toString(ProcessHandle.current().pid()));
+
+        final OutputAnalyzer output = ProcessTools.executeProcess(launcher.getCommand());
+        output.shouldHaveExitValue(0);
+
+        // Histogram lines have the format "num: #instances #bytes class name"
+        final String name = Element.class.getName();
+        long instances = -1;
+        for (String line : output.asLines()) {
+            final String[] columns = line.trim().split("\\s+");
+            if (columns.length >= 4 && columns[3].equals(name)) {
+                instances = Long.parseLong(columns[1]);
+            }
+        }
+
+        if (instances != elements) {
+            throw new RuntimeException("Expected " + elements + " instances of " + name + ", found " + instances);
+        }
+    }
+}
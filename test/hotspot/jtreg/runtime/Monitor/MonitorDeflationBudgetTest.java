@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test MonitorDeflationBudgetTest
+ * @summary Test that an async deflation pass that exceeds MonitorDeflationMax
+ *          is continued by later requests until all idle monitors are deflated
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ * @run driver MonitorDeflationBudgetTest
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+
+public class MonitorDeflationBudgetTest {
+    private static final int budget = 1024;
+    private static final int monitors = 20 * budget;
+
+    static class Test {
+        public static Object[] objects;
+
+        public static void main(String[] args) throws Exception {
+            objects = new Object[monitors];
+            for (int i = 0; i < monitors; i++) {
+                objects[i] = new Object();
+                synchronized (objects[i]) {
+                    // Taking the identity hash of a locked object inflates its monitor
+                    objects[i].hashCode();
+                }
+                // The monitor is idle again and can be deflated
+            }
+
+            // Only returns true once a whole pass over the in-use lists has finished
+            if (!WhiteBox.getWhiteBox().deflateIdleMonitors()) {
+                throw new RuntimeException("Async deflation pass did not finish");
+            }
+
+            System.out.println("Test done");
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-Xbootclasspath/a:.",
+                "-XX:+UnlockDiagnosticVMOptions",
+                "-XX:+WhiteBoxAPI",
+                "-XX:MonitorDeflationMax=" + budget,
+                "-Xlog:monitorinflation=debug",
+                Test.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Test done");
+
+        // The pass over the in-use monitors is split into several budgeted steps
+        final long steps = output.asLines().stream()
+                .filter(line -> line.contains("async deflation budget of " + budget + " monitors used up, continuing later."))
+                .count();
+        if (steps < monitors / budget - 1) {
+            throw new RuntimeException("Expected at least " + (monitors / budget - 1) + " budgeted steps, found " + steps);
+        }
+    }
+}